@@ -8,27 +8,49 @@
 #ifndef BIG_INT_HPP
 #define BIG_INT_HPP
 
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <tuple>
+
+#include "LimbVector.hpp"
 
 class BigInt {
-    std::string value;
+    LimbVector limbs;   // least significant limb first, without any leading
+                        // zero limbs (so zero has no limbs)
     char sign;
 
+    // Sets the BigInt to the sum or difference of two BigInts, or of a BigInt
+    // and an integer:
+    void assign_sum(const BigInt&, const BigInt&, bool);
+    void assign_sum(const BigInt&, const long long&, bool);
+    // Sets the BigInt to the product or quotient of a BigInt and an integer:
+    void assign_product(const BigInt&, const long long&);
+    void assign_quotient(const BigInt&, const long long&);
+    // Sets the BigInt to the integer written in a string in some base:
+    void assign_string(const std::string&, int);
+    // Adds the product of two magnitudes to the BigInt, or subtracts it:
+    void accumulate_product(const Limb*, size_t, const Limb*, size_t, bool);
+
     public:
         // Constructors:
         BigInt();
         BigInt(const BigInt&);
+        BigInt(BigInt&&) noexcept;
         BigInt(const long long&);
         BigInt(const std::string&);
 
         // Assignment operators:
         BigInt& operator=(const BigInt&);
+        BigInt& operator=(BigInt&&) noexcept;
         BigInt& operator=(const long long&);
         BigInt& operator=(const std::string&);
+        friend void swap(BigInt&, BigInt&) noexcept;
 
         // Unary arithmetic operators:
         BigInt operator+() const;   // unary +
         BigInt operator-() const;   // unary -
+        friend BigInt operator-(BigInt&&);
 
         // Binary arithmetic operators:
         BigInt operator+(const BigInt&) const;
@@ -47,6 +69,21 @@ class BigInt {
         BigInt operator/(const std::string&) const;
         BigInt operator%(const std::string&) const;
 
+        // Binary arithmetic operators that reuse the storage of a temporary:
+        friend BigInt operator+(BigInt&&, const BigInt&);
+        friend BigInt operator+(const BigInt&, BigInt&&);
+        friend BigInt operator+(BigInt&&, BigInt&&);
+        friend BigInt operator+(BigInt&&, const long long&);
+        friend BigInt operator+(BigInt&&, const std::string&);
+        friend BigInt operator-(BigInt&&, const BigInt&);
+        friend BigInt operator-(const BigInt&, BigInt&&);
+        friend BigInt operator-(BigInt&&, BigInt&&);
+        friend BigInt operator-(BigInt&&, const long long&);
+        friend BigInt operator-(BigInt&&, const std::string&);
+        friend BigInt operator*(BigInt&&, const long long&);
+        friend BigInt operator*(const long long&, BigInt&&);
+        friend BigInt operator/(BigInt&&, const long long&);
+
         // Arithmetic-assignment operators:
         BigInt& operator+=(const BigInt&);
         BigInt& operator-=(const BigInt&);
@@ -90,18 +127,39 @@ class BigInt {
         bool operator==(const std::string&) const;
         bool operator!=(const std::string&) const;
 
+        // Three-way comparison functions:
+        friend int compare(const BigInt&, const BigInt&);
+        friend int compare(const BigInt&, const long long&);
+        friend int compare_abs(const BigInt&, const BigInt&);
+        friend int compare_abs(const BigInt&, const long long&);
+
         // I/O stream operators:
         friend std::istream& operator>>(std::istream&, BigInt&);
         friend std::ostream& operator<<(std::ostream&, const BigInt&);
 
         // Conversion functions:
-        std::string to_string() const;
+        std::string to_string(int base = 10) const;
+        friend BigInt from_string(const std::string&, int);
         int to_int() const;
         long to_long() const;
         long long to_long_long() const;
 
-        // Random number generating functions:
-        friend BigInt big_random(size_t);
+        // Serialization functions:
+        friend size_t serialized_size(const BigInt&);
+        friend size_t serialize(const BigInt&, uint8_t*, size_t);
+        friend class BigIntView;
+
+        // Helper functions that work on the magnitude:
+        friend std::tuple<BigInt, BigInt> divide(const BigInt&, const BigInt&);
+        friend std::tuple<BigInt, BigInt> divmod(const BigInt&, const BigInt&);
+        friend std::tuple<BigInt, BigInt> divmod(const BigInt&, const long long&);
+        friend long long modulo(const BigInt&, const long long&);
+        friend BigInt square(const BigInt&);
+        friend void addmul(BigInt&, const BigInt&, const BigInt&);
+        friend void addmul(BigInt&, const BigInt&, const long long&);
+        friend void submul(BigInt&, const BigInt&, const BigInt&);
+        friend void submul(BigInt&, const BigInt&, const long long&);
+        friend BigInt sqrt(const BigInt&);
 };
 
 #endif  // BIG_INT_HPP
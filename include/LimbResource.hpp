@@ -0,0 +1,212 @@
+/*
+    ===========================================================================
+    Limb memory resources
+    ===========================================================================
+    Every heap allocation of limbs made by a BigInt (and by the algorithms
+    operating on them) goes through the limb resource of the current thread,
+    which by default is the global heap.
+    A LimbArena can be made the current resource for a scope, so that all the
+    temporaries of a computation are bump-allocated from a few large blocks
+    that are freed together, without touching the global heap (or contending
+    with other threads for it).
+*/
+
+#ifndef BIG_INT_LIMB_RESOURCE_HPP
+#define BIG_INT_LIMB_RESOURCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// The magnitude of a BigInt is stored in base 2^32, one limb per digit. The
+// product of two limbs (plus carries) always fits in a double limb.
+typedef uint32_t Limb;
+typedef uint64_t DoubleLimb;
+const int LIMB_BITS = 32;
+
+
+/*
+    LimbResource
+    ------------
+    Interface for the resources that limbs are allocated from.
+*/
+
+class LimbResource {
+    public:
+        virtual ~LimbResource() {}
+
+        // Returns space for `count` limbs.
+        virtual Limb* allocate(size_t count) = 0;
+
+        // Returns space for `count` limbs, obtained from `allocate`, to the
+        // resource.
+        virtual void deallocate(Limb* limbs, size_t count) = 0;
+};
+
+
+/*
+    HeapLimbResource
+    ----------------
+    Allocates limbs from the global heap.
+*/
+
+class HeapLimbResource : public LimbResource {
+    public:
+        Limb* allocate(size_t count) override {
+            return new Limb[count];
+        }
+
+        void deallocate(Limb* limbs, size_t) override {
+            delete[] limbs;
+        }
+};
+
+
+/*
+    heap_limb_resource
+    ------------------
+    Returns the resource that allocates limbs from the global heap.
+*/
+
+LimbResource* heap_limb_resource() {
+    static HeapLimbResource resource;
+
+    return &resource;
+}
+
+
+/*
+    current_limb_resource
+    ---------------------
+    Returns (a reference to) the resource that the current thread allocates
+    limbs from.
+*/
+
+LimbResource*& current_limb_resource() {
+    static thread_local LimbResource* resource = heap_limb_resource();
+
+    return resource;
+}
+
+
+/*
+    LimbResourceScope
+    -----------------
+    Makes a resource the one that the current thread allocates limbs from,
+    until the end of the scope.
+    This can also be used inside the scope of a LimbArena, with
+    `heap_limb_resource()`, to copy a result that should outlive the arena.
+*/
+
+class LimbResourceScope {
+    LimbResource* previous_resource;
+
+    public:
+        explicit LimbResourceScope(LimbResource* resource)
+                : previous_resource(current_limb_resource()) {
+            current_limb_resource() = resource;
+        }
+
+        ~LimbResourceScope() {
+            current_limb_resource() = previous_resource;
+        }
+
+        LimbResourceScope(const LimbResourceScope&) = delete;
+        LimbResourceScope& operator=(const LimbResourceScope&) = delete;
+};
+
+
+/*
+    LimbArena
+    ---------
+    A resource that bump-allocates limbs from blocks that grow geometrically,
+    and which is the one that the current thread allocates limbs from, from
+    its construction until its destruction, when all its blocks are freed.
+    Deallocating the latest allocation reclaims its space, and deallocating
+    any other one is a no-op.
+    NOTE: every BigInt that allocates its limbs while the arena is in use must
+          be destroyed before the arena is. To keep a result, copy it to a
+          BigInt declared outside the arena's scope under a LimbResourceScope
+          of `heap_limb_resource()`.
+*/
+
+class LimbArena : public LimbResource {
+    std::vector<Limb*> blocks;
+    size_t next_block_size;
+    Limb* free_limbs;           // start of the unused part of the latest block
+    size_t free_count;          // size of the unused part of the latest block
+    LimbResourceScope scope;
+
+    public:
+        explicit LimbArena(size_t initial_block_size = 4096);
+        ~LimbArena();
+
+        LimbArena(const LimbArena&) = delete;
+        LimbArena& operator=(const LimbArena&) = delete;
+
+        Limb* allocate(size_t count) override;
+        void deallocate(Limb* limbs, size_t count) override;
+};
+
+
+/*
+    LimbArena constructor
+    ---------------------
+    Makes the arena the resource that the current thread allocates limbs from.
+    Its first block will have space for (at least) `initial_block_size` limbs.
+*/
+
+LimbArena::LimbArena(size_t initial_block_size)
+        : next_block_size(std::max(initial_block_size, (size_t) 1)),
+          free_limbs(nullptr), free_count(0), scope(this) {}
+
+
+/*
+    LimbArena destructor
+    --------------------
+    Restores the resource that the current thread allocated limbs from before
+    the arena, and frees all of the arena's blocks.
+*/
+
+LimbArena::~LimbArena() {
+    for (Limb* block : blocks)
+        delete[] block;
+}
+
+
+/*
+    LimbArena::allocate
+    -------------------
+*/
+
+Limb* LimbArena::allocate(size_t count) {
+    if (count > free_count) {
+        size_t block_size = std::max(next_block_size, count);
+        blocks.push_back(new Limb[block_size]);
+        free_limbs = blocks.back();
+        free_count = block_size;
+        next_block_size = 2 * block_size;
+    }
+
+    Limb* limbs = free_limbs;
+    free_limbs += count;
+    free_count -= count;
+
+    return limbs;
+}
+
+
+/*
+    LimbArena::deallocate
+    ---------------------
+*/
+
+void LimbArena::deallocate(Limb* limbs, size_t count) {
+    if (limbs + count == free_limbs) {
+        free_limbs = limbs;
+        free_count += count;
+    }
+}
+
+#endif  // BIG_INT_LIMB_RESOURCE_HPP
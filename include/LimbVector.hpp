@@ -0,0 +1,350 @@
+/*
+    ===========================================================================
+    LimbVector
+    ===========================================================================
+    Definition for the LimbVector class, the storage for the magnitude of a
+    BigInt.
+    It behaves like a std::vector of limbs, except that up to INLINE_LIMBS of
+    them are kept inside the object itself, so that small BigInts never
+    allocate memory. It moves its limbs to the heap only once they outgrow
+    that space, which it allocates from the limb resource of the current
+    thread.
+*/
+
+#ifndef BIG_INT_LIMB_VECTOR_HPP
+#define BIG_INT_LIMB_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include "LimbResource.hpp"
+
+// Values below 2^128 are stored inline.
+const size_t INLINE_LIMBS = 4;
+
+class LimbVector {
+    Limb* limbs_data;       // either `inline_limbs` or a heap allocation
+    size_t limbs_size;
+    size_t limbs_capacity;
+    LimbResource* limbs_resource;   // the resource of the heap allocation
+    Limb inline_limbs[INLINE_LIMBS];
+
+    bool is_inline() const { return limbs_data == inline_limbs; }
+    void deallocate();
+
+    public:
+        // Constructors:
+        LimbVector();
+        explicit LimbVector(size_t, Limb = 0);
+        LimbVector(const Limb*, const Limb*);
+        LimbVector(const LimbVector&);
+        LimbVector(LimbVector&&) noexcept;
+
+        // Destructor:
+        ~LimbVector();
+
+        // Assignment operators:
+        LimbVector& operator=(const LimbVector&);
+        LimbVector& operator=(LimbVector&&) noexcept;
+        void swap(LimbVector&) noexcept;
+
+        // Element access:
+        Limb& operator[](size_t i) { return limbs_data[i]; }
+        const Limb& operator[](size_t i) const { return limbs_data[i]; }
+        Limb& back() { return limbs_data[limbs_size - 1]; }
+        const Limb& back() const { return limbs_data[limbs_size - 1]; }
+        Limb* data() { return limbs_data; }
+        const Limb* data() const { return limbs_data; }
+
+        // Iterators:
+        Limb* begin() { return limbs_data; }
+        const Limb* begin() const { return limbs_data; }
+        Limb* end() { return limbs_data + limbs_size; }
+        const Limb* end() const { return limbs_data + limbs_size; }
+
+        // Capacity:
+        bool empty() const { return limbs_size == 0; }
+        size_t size() const { return limbs_size; }
+        size_t capacity() const { return limbs_capacity; }
+        void reserve(size_t);
+
+        // Modifiers:
+        void clear() { limbs_size = 0; }
+        void push_back(Limb);
+        void pop_back() { limbs_size--; }
+        void resize(size_t, Limb = 0);
+        void assign(size_t, Limb);
+        void assign(const Limb*, const Limb*);
+        Limb* insert(Limb*, const Limb*, const Limb*);
+
+        // Relational operators:
+        bool operator==(const LimbVector&) const;
+        bool operator!=(const LimbVector&) const;
+};
+
+
+/*
+    Default constructor
+    -------------------
+*/
+
+LimbVector::LimbVector() : limbs_data(inline_limbs), limbs_size(0),
+        limbs_capacity(INLINE_LIMBS), limbs_resource(nullptr) {}
+
+
+/*
+    Fill constructor
+    ----------------
+*/
+
+LimbVector::LimbVector(size_t size, Limb value) : LimbVector() {
+    assign(size, value);
+}
+
+
+/*
+    Range constructor
+    -----------------
+*/
+
+LimbVector::LimbVector(const Limb* first, const Limb* last) : LimbVector() {
+    assign(first, last);
+}
+
+
+/*
+    Copy constructor
+    ----------------
+*/
+
+LimbVector::LimbVector(const LimbVector& limbs) : LimbVector() {
+    assign(limbs.begin(), limbs.end());
+}
+
+
+/*
+    Move constructor
+    ----------------
+    Takes over the heap allocation of `limbs`, if it has one, which is left
+    empty.
+*/
+
+LimbVector::LimbVector(LimbVector&& limbs) noexcept : LimbVector() {
+    *this = std::move(limbs);
+}
+
+
+/*
+    Destructor
+    ----------
+*/
+
+LimbVector::~LimbVector() {
+    deallocate();
+}
+
+
+/*
+    deallocate
+    ----------
+    Returns the heap allocation, if there is one, to the resource it came
+    from.
+*/
+
+void LimbVector::deallocate() {
+    if (!is_inline())
+        limbs_resource->deallocate(limbs_data, limbs_capacity);
+}
+
+
+/*
+    LimbVector = LimbVector
+    -----------------------
+*/
+
+LimbVector& LimbVector::operator=(const LimbVector& limbs) {
+    if (this != &limbs)
+        assign(limbs.begin(), limbs.end());
+
+    return *this;
+}
+
+
+/*
+    LimbVector = LimbVector (move)
+    ------------------------------
+    Takes over the heap allocation of `limbs`, if it has one, and otherwise
+    copies its inline limbs. Either way, `limbs` is left empty.
+*/
+
+LimbVector& LimbVector::operator=(LimbVector&& limbs) noexcept {
+    if (this == &limbs)
+        return *this;
+
+    if (limbs.is_inline()) {
+        // a copy that fits in any capacity, so it never allocates
+        std::copy(limbs.begin(), limbs.end(), limbs_data);
+        limbs_size = limbs.limbs_size;
+    }
+    else {
+        deallocate();
+        limbs_data = limbs.limbs_data;
+        limbs_size = limbs.limbs_size;
+        limbs_capacity = limbs.limbs_capacity;
+        limbs_resource = limbs.limbs_resource;
+        limbs.limbs_data = limbs.inline_limbs;
+        limbs.limbs_capacity = INLINE_LIMBS;
+    }
+    limbs.limbs_size = 0;
+
+    return *this;
+}
+
+
+/*
+    swap
+    ----
+*/
+
+void LimbVector::swap(LimbVector& limbs) noexcept {
+    if (!is_inline() and !limbs.is_inline()) {
+        std::swap(limbs_data, limbs.limbs_data);
+        std::swap(limbs_size, limbs.limbs_size);
+        std::swap(limbs_capacity, limbs.limbs_capacity);
+        std::swap(limbs_resource, limbs.limbs_resource);
+        return;
+    }
+
+    LimbVector temp(std::move(limbs));
+    limbs = std::move(*this);
+    *this = std::move(temp);
+}
+
+
+/*
+    reserve
+    -------
+    Makes room for at least `capacity` limbs, moving them to the heap if they
+    no longer fit where they are.
+*/
+
+void LimbVector::reserve(size_t capacity) {
+    if (capacity <= limbs_capacity)
+        return;
+
+    LimbResource* resource = current_limb_resource();
+    Limb* allocation = resource->allocate(capacity);
+    std::copy(begin(), end(), allocation);
+    deallocate();
+    limbs_data = allocation;
+    limbs_capacity = capacity;
+    limbs_resource = resource;
+}
+
+
+/*
+    push_back
+    ---------
+*/
+
+void LimbVector::push_back(Limb limb) {
+    if (limbs_size == limbs_capacity)
+        reserve(2 * limbs_capacity);
+    limbs_data[limbs_size++] = limb;
+}
+
+
+/*
+    resize
+    ------
+    Changes the number of limbs to `size`, filling any new ones with `value`.
+*/
+
+void LimbVector::resize(size_t size, Limb value) {
+    if (size > limbs_capacity)
+        reserve(std::max(size, 2 * limbs_capacity));
+    if (size > limbs_size) {
+        // zero limbs, by far the most common filling, are written by memset,
+        // which is much faster than a loop that the compiler may not vectorise
+        if (value == 0)
+            std::memset(end(), 0, (size - limbs_size) * sizeof(Limb));
+        else
+            std::fill(end(), begin() + size, value);
+    }
+    limbs_size = size;
+}
+
+
+/*
+    assign (fill)
+    -------------
+*/
+
+void LimbVector::assign(size_t size, Limb value) {
+    clear();
+    resize(size, value);
+}
+
+
+/*
+    assign (range)
+    --------------
+    NOTE: the range should not be part of the LimbVector itself.
+*/
+
+void LimbVector::assign(const Limb* first, const Limb* last) {
+    size_t size = last - first;
+    clear();
+    reserve(size);
+    std::copy(first, last, limbs_data);
+    limbs_size = size;
+}
+
+
+/*
+    insert
+    ------
+    Inserts the range of limbs from `first` to `last` before `position`, and
+    returns a pointer to the first inserted limb.
+    NOTE: the range should not be part of the LimbVector itself.
+*/
+
+Limb* LimbVector::insert(Limb* position, const Limb* first, const Limb* last) {
+    size_t offset = position - limbs_data;
+    size_t count = last - first;
+    size_t old_size = limbs_size;
+    if (old_size + count > limbs_capacity)
+        reserve(std::max(old_size + count, 2 * limbs_capacity));
+
+    std::copy_backward(begin() + offset, begin() + old_size,
+                       begin() + old_size + count);
+    std::copy(first, last, begin() + offset);
+    limbs_size = old_size + count;
+
+    return begin() + offset;
+}
+
+
+/*
+    LimbVector == LimbVector
+    ------------------------
+*/
+
+bool LimbVector::operator==(const LimbVector& limbs) const {
+    return limbs_size == limbs.limbs_size
+           and std::equal(begin(), end(), limbs.begin());
+}
+
+
+/*
+    LimbVector != LimbVector
+    ------------------------
+*/
+
+bool LimbVector::operator!=(const LimbVector& limbs) const {
+    return !(*this == limbs);
+}
+
+#endif  // BIG_INT_LIMB_VECTOR_HPP
@@ -0,0 +1,254 @@
+/*
+    ===========================================================================
+    Addition and subtraction of magnitudes
+    ===========================================================================
+    The kernels work on little-endian arrays of limbs and make a single pass
+    from the least significant limb upwards, keeping the carry or borrow in a
+    register (two limbs at a time, where algorithms/words.hpp allows it). The
+    result may share storage with either operand, which lets BigInt add and
+    subtract in place.
+*/
+
+#ifndef BIG_INT_ADDITION_ALGORITHMS_HPP
+#define BIG_INT_ADDITION_ALGORITHMS_HPP
+
+#include <algorithm>
+
+#include "BigInt.hpp"
+#include "algorithms/words.hpp"
+#include "functions/utility.hpp"
+
+
+/*
+    add_limbs
+    ---------
+    Adds `num2` (of `size2` limbs) to `num1` (of `size1` limbs, where `size1`
+    is at least `size2`), stores the `size1` least significant limbs of the sum
+    in `result` and returns the carry out of the most significant limb.
+*/
+
+Limb add_limbs(Limb* result, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2) {
+    DoubleLimb carry = 0;
+    size_t i = 0;
+#ifdef BIG_INT_WIDE_KERNELS
+    for (; i + 2 <= size2; i += 2) {
+        DoubleWord sum = (DoubleWord) load_word(num1 + i) + load_word(num2 + i) + carry;
+        store_word(result + i, (Word) sum);
+        carry = (DoubleLimb) (sum >> WORD_BITS);
+    }
+#endif
+    for (; i < size2; i++) {
+        carry += (DoubleLimb) num1[i] + num2[i];
+        result[i] = (Limb) carry;
+        carry >>= LIMB_BITS;
+    }
+    for (; carry and i < size1; i++) {
+        carry += num1[i];
+        result[i] = (Limb) carry;
+        carry >>= LIMB_BITS;
+    }
+    // once the carry dies out, an in-place sum is already complete
+    if (result != num1)
+        for (; i < size1; i++)
+            result[i] = num1[i];
+
+    return (Limb) carry;
+}
+
+
+/*
+    subtract_limbs
+    --------------
+    Subtracts `num2` (of `size2` limbs) from `num1` (of `size1` limbs, where
+    `size1` is at least `size2`), stores the `size1` least significant limbs of
+    the difference in `result` and returns the borrow out of the most
+    significant limb, which is 0 whenever `num1` is at least `num2`.
+*/
+
+Limb subtract_limbs(Limb* result, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2) {
+    DoubleLimb borrow = 0, difference;
+    size_t i = 0;
+#ifdef BIG_INT_WIDE_KERNELS
+    for (; i + 2 <= size2; i += 2) {
+        DoubleWord word_difference = (DoubleWord) load_word(num1 + i)
+                                     - load_word(num2 + i) - borrow;
+        store_word(result + i, (Word) word_difference);
+        borrow = (DoubleLimb) (word_difference >> (2 * WORD_BITS - 1));
+    }
+#endif
+    for (; i < size2; i++) {
+        difference = (DoubleLimb) num1[i] - num2[i] - borrow;
+        result[i] = (Limb) difference;
+        borrow = difference >> (2 * LIMB_BITS - 1);     // wrapped around
+    }
+    for (; borrow and i < size1; i++) {
+        difference = (DoubleLimb) num1[i] - borrow;
+        result[i] = (Limb) difference;
+        borrow = difference >> (2 * LIMB_BITS - 1);
+    }
+    if (result != num1)
+        for (; i < size1; i++)
+            result[i] = num1[i];
+
+    return (Limb) borrow;
+}
+
+
+/*
+    difference_limbs
+    ----------------
+    Stores the absolute difference of `num1` (of `size1` limbs) and `num2` (of
+    `size2` limbs, where `size1` is at least `size2`) in the `size1` limbs of
+    `result`, and returns whether `num1` is less than `num2`.
+*/
+
+bool difference_limbs(Limb* result, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2) {
+    bool negative = true;
+    size_t i = size1;
+    for (; i > size2; i--)
+        if (num1[i - 1] != 0) {
+            negative = false;
+            break;
+        }
+    if (i == size2) {
+        while (i > 0 and num1[i - 1] == num2[i - 1])
+            i--;
+        negative = i > 0 and num1[i - 1] < num2[i - 1];
+    }
+
+    if (!negative)
+        subtract_limbs(result, num1, size1, num2, size2);
+    else {
+        // the limbs of `num1` beyond `size2` are all zero
+        subtract_limbs(result, num2, size2, num1, size2);
+        std::fill(result + size2, result + size1, 0);
+    }
+
+    return negative;
+}
+
+
+/*
+    add_magnitudes
+    --------------
+    Stores the sum of the magnitudes `num1` and `num2` in `result`, which may
+    be the same vector as either of them.
+*/
+
+void add_magnitudes(LimbVector& result, const LimbVector& num1,
+        const LimbVector& num2) {
+    const LimbVector& larger = num1.size() >= num2.size() ? num1 : num2;
+    const LimbVector& smaller = num1.size() >= num2.size() ? num2 : num1;
+    size_t larger_size = larger.size(), smaller_size = smaller.size();
+
+    // size the result up front (the extra limb is for the carry), so that the
+    // kernel never has to reallocate it
+    result.reserve(larger_size + 1);
+    result.resize(larger_size);
+    Limb carry = add_limbs(result.data(), larger.data(), larger_size,
+                           smaller.data(), smaller_size);
+    if (carry)
+        result.push_back(carry);
+}
+
+
+/*
+    subtract_magnitudes
+    -------------------
+    Stores the difference of the magnitudes `num1` and `num2` in `result`,
+    which may be the same vector as either of them.
+    NOTE: `num1` should not be less than `num2`.
+*/
+
+void subtract_magnitudes(LimbVector& result, const LimbVector& num1,
+        const LimbVector& num2) {
+    size_t size1 = num1.size(), size2 = num2.size();
+
+    result.resize(size1);
+    subtract_limbs(result.data(), num1.data(), size1, num2.data(), size2);
+    strip_leading_zero_limbs(result);
+}
+
+
+/*
+    assign_sum
+    ----------
+    Sets the BigInt to `num1 + num2`, or to `num1 - num2` if `subtract` is
+    true. Either operand may be the BigInt itself.
+*/
+
+void BigInt::assign_sum(const BigInt& num1, const BigInt& num2, bool subtract) {
+    char sign1 = num1.sign;
+    char sign2 = num2.sign;
+    if (subtract)
+        sign2 = sign2 == '+' ? '-' : '+';
+
+    if (sign1 == sign2) {
+        add_magnitudes(limbs, num1.limbs, num2.limbs);
+        sign = sign1;
+    }
+    else if (compare_limbs(num1.limbs, num2.limbs) >= 0) {
+        subtract_magnitudes(limbs, num1.limbs, num2.limbs);
+        sign = sign1;
+    }
+    else {
+        subtract_magnitudes(limbs, num2.limbs, num1.limbs);
+        sign = sign2;
+    }
+
+    if (limbs.empty())      // zero is never negative
+        sign = '+';
+}
+
+
+/*
+    assign_sum (Integer)
+    --------------------
+    Sets the BigInt to `num1 + num2`, or to `num1 - num2` if `subtract` is
+    true, working on the limbs of the integer directly. `num1` may be the
+    BigInt itself.
+*/
+
+void BigInt::assign_sum(const BigInt& num1, const long long& num2, bool subtract) {
+    Limb num2_limbs[2];
+    size_t size2 = magnitude_to_limbs(num2, num2_limbs);
+    char sign1 = num1.sign;
+    char sign2 = (num2 < 0) != subtract ? '-' : '+';
+
+    if (this != &num1) {
+        limbs.reserve(num1.limbs.size() + 1);
+        limbs = num1.limbs;
+    }
+
+    if (sign1 == sign2 or size2 == 0) {
+        if (limbs.size() < size2)
+            limbs.resize(size2, 0);
+        Limb carry = add_limbs(limbs.data(), limbs.data(), limbs.size(),
+                               num2_limbs, size2);
+        if (carry)
+            limbs.push_back(carry);
+        sign = sign1;
+    }
+    else if (compare_limbs(limbs.data(), limbs.size(), num2_limbs, size2) >= 0) {
+        subtract_limbs(limbs.data(), limbs.data(), limbs.size(), num2_limbs, size2);
+        strip_leading_zero_limbs(limbs);
+        sign = sign1;
+    }
+    else {
+        // the magnitude of `num1` is the smaller one, so it has no more limbs
+        // than the integer, and can be subtracted from it in place
+        size_t size1 = limbs.size();
+        limbs.resize(size2, 0);
+        subtract_limbs(limbs.data(), num2_limbs, size2, limbs.data(), size1);
+        strip_leading_zero_limbs(limbs);
+        sign = sign2;
+    }
+
+    if (limbs.empty())      // zero is never negative
+        sign = '+';
+}
+
+#endif  // BIG_INT_ADDITION_ALGORITHMS_HPP
@@ -0,0 +1,363 @@
+/*
+    ===========================================================================
+    Division of magnitudes
+    ===========================================================================
+    Quotients and remainders are computed together, by one of several
+    algorithms, chosen by the length (in limbs) of the divisor:
+        - a single pass of limb-by-limb divisions, for a one-limb divisor
+        - Knuth's Algorithm D (The Art of Computer Programming, Vol. 2,
+          Section 4.3.1), below DIVISION_RECURSIVE_THRESHOLD
+        - recursive (divide-and-conquer) division, beyond that, which is
+          the algorithm of Burnikel and Ziegler as presented in Brent and
+          Zimmermann's Modern Computer Arithmetic (Algorithm 1.8); it spends
+          most of its time in multiplications, so it scales with them
+*/
+
+#ifndef BIG_INT_DIVISION_ALGORITHMS_HPP
+#define BIG_INT_DIVISION_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "BigInt.hpp"
+#include "algorithms/addition.hpp"
+#include "algorithms/multiplication.hpp"
+#include "algorithms/thresholds.hpp"
+#include "functions/utility.hpp"
+
+
+/*
+    count_leading_zero_bits
+    -----------------------
+    Returns the number of most significant zero bits in a non-zero limb.
+*/
+
+int count_leading_zero_bits(Limb limb) {
+    int num_bits = 0;
+    for (; !(limb & ((Limb) 1 << (LIMB_BITS - 1))); limb <<= 1)
+        num_bits++;
+
+    return num_bits;
+}
+
+
+/*
+    shift_limbs_left
+    ----------------
+    Stores `num` (of `size` limbs) shifted left by `shift` bits (less than
+    LIMB_BITS) in `result`, which may be the same as `num`, and returns the
+    bits shifted out of the most significant limb.
+*/
+
+Limb shift_limbs_left(Limb* result, const Limb* num, size_t size, int shift) {
+    if (shift == 0) {
+        std::copy(num, num + size, result);
+        return 0;
+    }
+
+    Limb shifted_out = 0;
+    for (size_t i = 0; i < size; i++) {
+        Limb limb = num[i];
+        result[i] = (limb << shift) | shifted_out;
+        shifted_out = limb >> (LIMB_BITS - shift);
+    }
+
+    return shifted_out;
+}
+
+
+/*
+    shift_limbs_right
+    -----------------
+    Stores `num` (of `size` limbs) shifted right by `shift` bits (less than
+    LIMB_BITS) in `result`, which may be the same as `num`.
+*/
+
+void shift_limbs_right(Limb* result, const Limb* num, size_t size, int shift) {
+    if (shift == 0) {
+        std::copy(num, num + size, result);
+        return;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        Limb next = i + 1 < size ? num[i + 1] : 0;
+        result[i] = (num[i] >> shift) | (next << (LIMB_BITS - shift));
+    }
+}
+
+
+/*
+    divide_knuth
+    ------------
+    Divides `num1` (of `size1` limbs) by `num2` (of `size2` limbs, at least 2
+    and no more than `size1`, with a non-zero most significant limb), storing
+    the quotient in `quotient` and the remainder in `remainder`, using Knuth's
+    Algorithm D.
+*/
+
+void divide_knuth(LimbVector& quotient, LimbVector& remainder,
+        const Limb* num1, size_t size1, const Limb* num2, size_t size2) {
+    // normalise both operands so that the divisor's most significant bit is
+    // set, which keeps each estimated quotient limb at most 2 too large
+    int shift = count_leading_zero_bits(num2[size2 - 1]);
+    LimbVector divisor(size2);
+    shift_limbs_left(divisor.data(), num2, size2, shift);
+    LimbVector& dividend = remainder;
+    dividend.resize(size1 + 1);
+    dividend[size1] = shift_limbs_left(dividend.data(), num1, size1, shift);
+
+    Limb divisor_top = divisor[size2 - 1];
+    Limb divisor_next = divisor[size2 - 2];
+    const DoubleLimb base = (DoubleLimb) 1 << LIMB_BITS;
+
+    quotient.assign(size1 - size2 + 1, 0);
+    for (size_t j = size1 - size2 + 1; j-- > 0; ) {
+        // estimate the quotient limb from the top two limbs of the current
+        // remainder and the top limb of the divisor, then refine it with the
+        // next limb of each, after which it is at most 1 too large
+        DoubleLimb numerator = ((DoubleLimb) dividend[j + size2] << LIMB_BITS)
+                               | dividend[j + size2 - 1];
+        DoubleLimb quotient_limb = numerator / divisor_top;
+        DoubleLimb remainder_top = numerator % divisor_top;
+        while (quotient_limb >= base
+                or quotient_limb * divisor_next
+                   > ((remainder_top << LIMB_BITS) | dividend[j + size2 - 2])) {
+            quotient_limb--;
+            remainder_top += divisor_top;
+            if (remainder_top >= base)
+                break;
+        }
+
+        // subtract quotient_limb * divisor from the current remainder, and add
+        // the divisor back in the rare case that the estimate was too large
+        Limb borrow = multiply_subtract_limbs(dividend.data() + j, divisor.data(),
+                                              size2, (Limb) quotient_limb);
+        if (dividend[j + size2] < borrow) {
+            quotient_limb--;
+            add_limbs(dividend.data() + j, dividend.data() + j, size2,
+                      divisor.data(), size2);
+        }
+        dividend[j + size2] = 0;
+        quotient[j] = (Limb) quotient_limb;
+    }
+
+    // the remainder is left in the low limbs of the dividend, still normalised
+    remainder.resize(size2);
+    shift_limbs_right(remainder.data(), remainder.data(), size2, shift);
+}
+
+
+/*
+    subtract_product_from_partial
+    -----------------------------
+    Subtracts `quotient * divisor_low` from the partial remainder `partial`,
+    first adding `divisor` to it (and decrementing `quotient`) as many times
+    as needed for the difference to be non-negative.
+*/
+
+void subtract_product_from_partial(LimbVector& partial,
+        LimbVector& quotient, const Limb* divisor, size_t divisor_size,
+        const Limb* divisor_low, size_t divisor_low_size) {
+    LimbVector product;
+    multiply_limbs(product, quotient.data(), quotient.size(),
+                   divisor_low, divisor_low_size);
+
+    strip_leading_zero_limbs(partial);
+    const Limb one = 1;
+    while (compare_limbs(partial, product) < 0) {
+        partial.resize(std::max(partial.size(), divisor_size) + 1);
+        add_limbs_at(partial.data(), partial.size(), 0, divisor, divisor_size);
+        strip_leading_zero_limbs(partial);
+        subtract_limbs(quotient.data(), quotient.data(), quotient.size(), &one, 1);
+    }
+    strip_leading_zero_limbs(quotient);
+    subtract_magnitudes(partial, partial, product);
+}
+
+
+void divide_recursive(LimbVector&, LimbVector&, const Limb*, size_t, const Limb*,
+        size_t);
+
+
+/*
+    divide_halves
+    -------------
+    Divides `num1` (of `size1` limbs) by `num2` (of `size2` limbs, with the
+    most significant bit set), storing the quotient in `quotient` and the
+    remainder in `remainder`, by finding the high and low halves of the
+    quotient with recursive divisions.
+    NOTE: `size1` should be at most twice `size2`, and the quotient should have
+          at least 2 limbs, and the divisor at least 4.
+*/
+
+void divide_halves(LimbVector& quotient, LimbVector& remainder,
+        const Limb* num1, size_t size1, const Limb* num2, size_t size2) {
+    // split the divisor into its `half_length` low limbs and the rest, and
+    // find the quotient's high and low halves in turn, each by dividing by the
+    // high part of the divisor and then correcting for the low part
+    size_t half_length = (size1 - size2) / 2;
+    const Limb* divisor_high = num2 + half_length;
+    size_t divisor_high_size = size2 - half_length;
+
+    LimbVector quotient_high, quotient_low, partial_remainder;
+    divide_recursive(quotient_high, partial_remainder, num1 + 2 * half_length,
+                     size1 - 2 * half_length, divisor_high, divisor_high_size);
+    partial_remainder.insert(partial_remainder.begin(), num1 + half_length,
+                             num1 + 2 * half_length);
+    subtract_product_from_partial(partial_remainder, quotient_high, num2, size2,
+                                  num2, half_length);
+
+    divide_recursive(quotient_low, remainder, partial_remainder.data(),
+                     partial_remainder.size(), divisor_high, divisor_high_size);
+    remainder.insert(remainder.begin(), num1, num1 + half_length);
+    subtract_product_from_partial(remainder, quotient_low, num2, size2,
+                                  num2, half_length);
+
+    quotient.assign(std::max(quotient_high.size() + half_length,
+                             quotient_low.size()) + 1, 0);
+    std::copy(quotient_low.begin(), quotient_low.end(), quotient.begin());
+    add_limbs_at(quotient.data(), quotient.size(), half_length,
+                 quotient_high.data(), quotient_high.size());
+    strip_leading_zero_limbs(quotient);
+}
+
+
+/*
+    divide_recursive
+    ----------------
+    Divides `num1` (of `size1` limbs) by `num2` (of `size2` limbs, with the
+    most significant bit set), storing the quotient in `quotient` and the
+    remainder in `remainder`, using recursive division, down to Knuth's
+    Algorithm D below DIVISION_RECURSIVE_THRESHOLD.
+    NOTE: `size1` should be at most twice `size2`.
+*/
+
+void divide_recursive(LimbVector& quotient, LimbVector& remainder,
+        const Limb* num1, size_t size1, const Limb* num2, size_t size2) {
+    while (size1 > 0 and num1[size1 - 1] == 0)
+        size1--;
+    if (size1 < size2) {
+        quotient.clear();
+        remainder.assign(num1, num1 + size1);
+        return;
+    }
+
+    size_t quotient_size = size1 - size2;
+    if (quotient_size < DIVISION_RECURSIVE_THRESHOLD
+            or size2 < DIVISION_RECURSIVE_THRESHOLD) {
+        divide_knuth(quotient, remainder, num1, size1, num2, size2);
+        strip_leading_zero_limbs(quotient);
+        strip_leading_zero_limbs(remainder);
+    }
+    else
+        divide_halves(quotient, remainder, num1, size1, num2, size2);
+}
+
+
+/*
+    divide_blocks
+    -------------
+    Divides `num1` (of `size1` limbs) by `num2` (of `size2` limbs, with a
+    non-zero most significant limb), storing the quotient in `quotient` and
+    the remainder in `remainder`, using recursive division on blocks of the
+    dividend as long as the divisor, from the most significant one down.
+*/
+
+void divide_blocks(LimbVector& quotient, LimbVector& remainder,
+        const Limb* num1, size_t size1, const Limb* num2, size_t size2) {
+    // normalise both operands so that the divisor's most significant bit is
+    // set, as recursive division needs
+    int shift = count_leading_zero_bits(num2[size2 - 1]);
+    LimbVector divisor(size2), dividend(size1 + 1);
+    shift_limbs_left(divisor.data(), num2, size2, shift);
+    dividend[size1] = shift_limbs_left(dividend.data(), num1, size1, shift);
+    strip_leading_zero_limbs(dividend);
+
+    // each block, preceded by the remainder so far (which is less than the
+    // divisor), gives a block of the quotient of at most `size2` limbs
+    size_t num_blocks = (dividend.size() + size2 - 1) / size2;
+    quotient.assign(num_blocks * size2 + 1, 0);
+    remainder.clear();
+    LimbVector partial, block_quotient;
+    for (size_t i = num_blocks; i-- > 0; ) {
+        size_t start = i * size2;
+        size_t end = std::min(start + size2, dividend.size());
+        partial.assign(dividend.begin() + start, dividend.begin() + end);
+        partial.insert(partial.end(), remainder.begin(), remainder.end());
+        divide_recursive(block_quotient, remainder, partial.data(), partial.size(),
+                         divisor.data(), size2);
+        add_limbs_at(quotient.data(), quotient.size(), start,
+                     block_quotient.data(), block_quotient.size());
+    }
+
+    shift_limbs_right(remainder.data(), remainder.data(), remainder.size(), shift);
+}
+
+
+/*
+    divide_limbs
+    ------------
+    Divides `num1` (of `size1` limbs) by a non-zero `num2` (of `size2` limbs),
+    storing the quotient in `quotient` and the remainder in `remainder`.
+    NOTE: neither result should share storage with either operand.
+*/
+
+void divide_limbs(LimbVector& quotient, LimbVector& remainder,
+        const Limb* num1, size_t size1, const Limb* num2, size_t size2) {
+    while (size1 > 0 and num1[size1 - 1] == 0)
+        size1--;
+    while (size2 > 0 and num2[size2 - 1] == 0)
+        size2--;
+
+    if (size1 < size2) {
+        quotient.clear();
+        remainder.assign(num1, num1 + size1);
+    }
+    else if (size2 == 1) {
+        quotient.assign(num1, num1 + size1);
+        Limb remainder_limb = divide_by_limb(quotient, num2[0]);
+        remainder.assign(1, remainder_limb);
+    }
+    else if (size2 < DIVISION_RECURSIVE_THRESHOLD
+            or size1 - size2 < DIVISION_RECURSIVE_THRESHOLD)
+        divide_knuth(quotient, remainder, num1, size1, num2, size2);
+    else
+        divide_blocks(quotient, remainder, num1, size1, num2, size2);
+
+    strip_leading_zero_limbs(quotient);
+    strip_leading_zero_limbs(remainder);
+}
+
+
+/*
+    assign_quotient (Integer)
+    -------------------------
+    Sets the BigInt to `num1 / num2`, truncated towards zero, dividing by an
+    integer that fits in a limb in a single pass. `num1` may be the BigInt
+    itself, which is then divided in place by such an integer.
+*/
+
+void BigInt::assign_quotient(const BigInt& num1, const long long& num2) {
+    Limb divisor[2];
+    size_t divisor_size = magnitude_to_limbs(num2, divisor);
+    if (divisor_size == 0)
+        throw std::logic_error("Attempted division by zero");
+    char quotient_sign = (num1.sign == '-') != (num2 < 0) ? '-' : '+';
+
+    if (divisor_size == 1) {
+        if (this != &num1)
+            limbs = num1.limbs;
+        divide_by_limb(limbs, divisor[0]);
+        strip_leading_zero_limbs(limbs);
+    }
+    else {
+        LimbVector quotient, remainder;
+        divide_limbs(quotient, remainder, num1.limbs.data(), num1.limbs.size(),
+                     divisor, divisor_size);
+        limbs = std::move(quotient);
+    }
+
+    sign = limbs.empty() ? '+' : quotient_sign;
+}
+
+#endif  // BIG_INT_DIVISION_ALGORITHMS_HPP
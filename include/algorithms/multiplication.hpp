@@ -0,0 +1,796 @@
+/*
+    ===========================================================================
+    Multiplication of magnitudes
+    ===========================================================================
+    Products are computed by one of several algorithms, chosen by the length
+    (in limbs) of the smaller operand:
+        - schoolbook multiplication, below KARATSUBA_THRESHOLD
+        - Karatsuba's algorithm, below TOOM3_THRESHOLD
+        - Toom-Cook 3-way multiplication, below TOOM4_THRESHOLD
+        - Toom-Cook 4-way multiplication, below NTT_THRESHOLD
+        - number-theoretic transforms, beyond that (as long as the product is
+          short enough for them)
+    Squares have tiers of their own, with thresholds prefixed by SQUARE_, since
+    each algorithm saves work when both operands are the same: the schoolbook
+    method computes every cross product once, and the others evaluate or
+    transform the operand only once.
+    All of the thresholds are defined in algorithms/thresholds.hpp.
+*/
+
+#ifndef BIG_INT_MULTIPLICATION_ALGORITHMS_HPP
+#define BIG_INT_MULTIPLICATION_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "BigInt.hpp"
+#include "algorithms/addition.hpp"
+#include "algorithms/ntt.hpp"
+#include "algorithms/parallel.hpp"
+#include "algorithms/thresholds.hpp"
+#include "algorithms/words.hpp"
+#include "functions/utility.hpp"
+
+// Toom-Cook multiplication evaluates both operands, split into `k` parts, at
+// the points 0, 1, ..., 2k - 3 and infinity. All of these are non-negative, so
+// every intermediate value is a magnitude.
+// Row `i` of each table below gives the coefficient `i + 1` of the product
+// polynomial as a combination of its values at the points 0, 1, ..., 2k - 3
+// and infinity (in that order), to be divided by the table's divisor.
+const Limb TOOM3_DIVISOR = 6;
+const long long TOOM3_INTERPOLATION[3][5] = {
+    {-11,  18,  -9,  2, -36},
+    {  6, -15,  12, -3,  66},
+    { -1,   3,  -3,  1, -36}
+};
+
+const Limb TOOM4_DIVISOR = 120;
+const long long TOOM4_INTERPOLATION[5][7] = {
+    {-274,  600, -600,  400, -150,  24, -14400},
+    { 225, -770, 1070, -780,  305, -50,  32880},
+    { -85,  355, -590,  490, -205,  35, -27000},
+    {  15,  -70,  130, -120,   55, -10,  10200},
+    {  -1,    5,  -10,   10,   -5,   1,  -1800}
+};
+
+
+/*
+    multiply_by_limb
+    ----------------
+    Stores the product of `num` (of `size` limbs) and `multiplier` in `result`,
+    which may be the same as `num`, and returns the carry out of the most
+    significant limb.
+*/
+
+Limb multiply_by_limb(Limb* result, const Limb* num, size_t size, Limb multiplier) {
+    DoubleLimb carry = 0;
+    size_t i = 0;
+#ifdef BIG_INT_WIDE_KERNELS
+    for (; i + 2 <= size; i += 2) {
+        DoubleWord product = (DoubleWord) load_word(num + i) * multiplier + carry;
+        store_word(result + i, (Word) product);
+        carry = (DoubleLimb) (product >> WORD_BITS);
+    }
+#endif
+    for (; i < size; i++) {
+        carry += (DoubleLimb) num[i] * multiplier;
+        result[i] = (Limb) carry;
+        carry >>= LIMB_BITS;
+    }
+
+    return (Limb) carry;
+}
+
+
+/*
+    multiply_accumulate_limbs
+    -------------------------
+    Adds the product of `num` (of `size` limbs) and `multiplier` to the `size`
+    limbs of `result`, and returns the carry out of the most significant limb.
+*/
+
+Limb multiply_accumulate_limbs(Limb* result, const Limb* num, size_t size,
+        Limb multiplier) {
+    DoubleLimb carry = 0;
+    size_t i = 0;
+#ifdef BIG_INT_WIDE_KERNELS
+    for (; i + 2 <= size; i += 2) {
+        DoubleWord product = (DoubleWord) load_word(num + i) * multiplier
+                             + load_word(result + i) + carry;
+        store_word(result + i, (Word) product);
+        carry = (DoubleLimb) (product >> WORD_BITS);
+    }
+#endif
+    for (; i < size; i++) {
+        carry += (DoubleLimb) num[i] * multiplier + result[i];
+        result[i] = (Limb) carry;
+        carry >>= LIMB_BITS;
+    }
+
+    return (Limb) carry;
+}
+
+
+/*
+    multiply_subtract_limbs
+    -----------------------
+    Subtracts the product of `num` (of `size` limbs) and `multiplier` from the
+    `size` limbs of `result`, and returns the borrow out of the most
+    significant limb.
+*/
+
+Limb multiply_subtract_limbs(Limb* result, const Limb* num, size_t size,
+        Limb multiplier) {
+    DoubleLimb borrow = 0;
+    size_t i = 0;
+#ifdef BIG_INT_WIDE_KERNELS
+    for (; i + 2 <= size; i += 2) {
+        DoubleWord product = (DoubleWord) load_word(num + i) * multiplier + borrow;
+        Word product_low = (Word) product, value = load_word(result + i);
+        borrow = (DoubleLimb) (product >> WORD_BITS) + (value < product_low);
+        store_word(result + i, value - product_low);
+    }
+#endif
+    for (; i < size; i++) {
+        DoubleLimb product = (DoubleLimb) num[i] * multiplier + borrow;
+        Limb product_low = (Limb) product;
+        borrow = (product >> LIMB_BITS) + (result[i] < product_low);
+        result[i] -= product_low;
+    }
+
+    return (Limb) borrow;
+}
+
+
+#ifdef BIG_INT_WIDE_KERNELS
+/*
+    multiply_accumulate_double_limb
+    -------------------------------
+    Adds the product of `num` (of `size` limbs) and the two-limb `multiplier`
+    to the `size` limbs of `result`, and returns the two limbs of the carry
+    out of the most significant limb.
+*/
+
+DoubleLimb multiply_accumulate_double_limb(Limb* result, const Limb* num,
+        size_t size, DoubleLimb multiplier) {
+    Word carry = 0;
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        // at most (2^64 - 1)^2 + 2 * (2^64 - 1), which fits exactly
+        DoubleWord product = (DoubleWord) load_word(num + i) * multiplier
+                             + load_word(result + i) + carry;
+        store_word(result + i, (Word) product);
+        carry = (Word) (product >> WORD_BITS);
+    }
+    if (i < size) {
+        DoubleWord product = (DoubleWord) num[i] * multiplier + result[i] + carry;
+        result[i] = (Limb) product;
+        carry = (Word) (product >> LIMB_BITS);
+    }
+
+    return carry;
+}
+
+
+/*
+    multiply_subtract_double_limb
+    -----------------------------
+    Subtracts the product of `num` (of `size` limbs) and the two-limb
+    `multiplier` from the `size` limbs of `result`, and returns the two limbs
+    of the borrow out of the most significant limb.
+*/
+
+DoubleLimb multiply_subtract_double_limb(Limb* result, const Limb* num,
+        size_t size, DoubleLimb multiplier) {
+    Word borrow = 0;
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        // at most 2^128 - 2^64, whose high word is only 2^64 - 1 when its low
+        // word is 0, so the borrow always fits in a word
+        DoubleWord product = (DoubleWord) load_word(num + i) * multiplier + borrow;
+        Word product_low = (Word) product, value = load_word(result + i);
+        borrow = (Word) (product >> WORD_BITS) + (value < product_low);
+        store_word(result + i, value - product_low);
+    }
+    if (i < size) {
+        DoubleWord product = (DoubleWord) num[i] * multiplier + borrow;
+        Limb product_low = (Limb) product;
+        borrow = (Word) (product >> LIMB_BITS) + (result[i] < product_low);
+        result[i] -= product_low;
+    }
+
+    return borrow;
+}
+#endif
+
+
+/*
+    add_limbs_at
+    ------------
+    Adds `num` (of `size` limbs) to `result` (of `result_size` limbs) starting
+    at the limb `offset`, propagating the carry as far as needed.
+    NOTE: the sum should fit in `result_size` limbs.
+*/
+
+void add_limbs_at(Limb* result, size_t result_size, size_t offset,
+        const Limb* num, size_t size) {
+    add_limbs(result + offset, result + offset, result_size - offset, num, size);
+}
+
+
+/*
+    multiply_schoolbook
+    -------------------
+    Stores the product of `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs) in the `size1 + size2` limbs of `result`, using the schoolbook
+    method with one row per limb (or two limbs) of `num2`.
+*/
+
+void multiply_schoolbook(Limb* result, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2) {
+    std::fill(result, result + size1 + size2, 0);
+    size_t i = 0;
+#ifdef BIG_INT_WIDE_KERNELS
+    // one row per two limbs of `num2`
+    for (; i + 2 <= size2; i += 2) {
+        DoubleLimb multiplier = num2[i] | (DoubleLimb) num2[i + 1] << LIMB_BITS;
+        DoubleLimb carry = multiply_accumulate_double_limb(result + i, num1, size1,
+                                                           multiplier);
+        result[i + size1] = (Limb) carry;
+        result[i + size1 + 1] = (Limb) (carry >> LIMB_BITS);
+    }
+#endif
+    for (; i < size2; i++)
+        result[i + size1] = multiply_accumulate_limbs(result + i, num1, size1, num2[i]);
+}
+
+
+/*
+    square_schoolbook
+    -----------------
+    Stores the square of `num` (of `size` limbs) in the `2 * size` limbs of
+    `result`, using the schoolbook method, but computing each cross product
+    only once and doubling their sum.
+*/
+
+void square_schoolbook(Limb* result, const Limb* num, size_t size) {
+    std::fill(result, result + 2 * size, 0);
+    // the products num[i] * num[j] with i < j, one row per limb num[i]
+    size_t i = 0;
+#ifdef BIG_INT_WIDE_KERNELS
+    // or one row per two limbs num[i] and num[i + 1], for every j > i + 1,
+    // followed by num[i] * num[i + 1] itself
+    for (; i + 2 < size; i += 2) {
+        DoubleLimb multiplier = num[i] | (DoubleLimb) num[i + 1] << LIMB_BITS;
+        DoubleLimb carry = multiply_accumulate_double_limb(result + 2 * i + 2,
+                num + i + 2, size - i - 2, multiplier);
+        result[i + size] = (Limb) carry;
+        result[i + size + 1] = (Limb) (carry >> LIMB_BITS);
+        DoubleLimb product = (DoubleLimb) num[i] * num[i + 1];
+        Limb product_limbs[2] = {(Limb) product, (Limb) (product >> LIMB_BITS)};
+        add_limbs_at(result, 2 * size, 2 * i + 1, product_limbs, 2);
+    }
+#endif
+    for (; i + 1 < size; i++)
+        result[i + size] = multiply_accumulate_limbs(result + 2 * i + 1, num + i + 1,
+                                                     size - i - 1, num[i]);
+    // the sum of the cross products is less than half the square, so doubling
+    // it never carries out
+    add_limbs(result, result, 2 * size, result, 2 * size);
+
+    // the products num[i] * num[i]
+    DoubleLimb carry = 0;
+    for (size_t i = 0; i < size; i++) {
+        DoubleLimb product = (DoubleLimb) num[i] * num[i];
+        carry += (DoubleLimb) result[2 * i] + (Limb) product;
+        result[2 * i] = (Limb) carry;
+        carry >>= LIMB_BITS;
+        carry += (DoubleLimb) result[2 * i + 1] + (product >> LIMB_BITS);
+        result[2 * i + 1] = (Limb) carry;
+        carry >>= LIMB_BITS;
+    }
+}
+
+
+void multiply_limbs(LimbVector&, const Limb*, size_t, const Limb*, size_t);
+
+
+/*
+    karatsuba_scratch_size
+    ----------------------
+    Returns the number of limbs of scratch space that karatsuba_limbs needs for
+    operands of up to `size` limbs.
+*/
+
+size_t karatsuba_scratch_size(size_t size) {
+    // the operands are always split once, and then their halves only as long
+    // as they are above the thresholds
+    size_t scratch_size = 4 * ((size + 1) / 2) + 1;
+    for (size = (size + 1) / 2;
+         size >= std::min(KARATSUBA_THRESHOLD, SQUARE_KARATSUBA_THRESHOLD);
+         size = (size + 1) / 2)
+        scratch_size += 4 * ((size + 1) / 2) + 1;
+
+    return scratch_size;
+}
+
+
+void karatsuba_or_schoolbook(Limb*, const Limb*, size_t, const Limb*, size_t, Limb*);
+
+
+/*
+    karatsuba_limbs
+    ---------------
+    Stores the product of `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs) in the `size1 + size2` limbs of `result`, using Karatsuba's
+    algorithm, with `scratch` of karatsuba_scratch_size(max(size1, size2))
+    limbs for all intermediate values, at every level of recursion.
+    The operands are split at least once, whatever their length.
+    If both operands are the same, all three partial products are squares.
+    NOTE: `result` should not overlap with either operand or `scratch`.
+*/
+
+void karatsuba_limbs(Limb* result, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2, Limb* scratch) {
+    if (size1 < size2) {
+        std::swap(num1, num2);
+        std::swap(size1, size2);
+    }
+    bool squaring = num1 == num2 and size1 == size2;
+
+    // split both operands after their `low_size` least significant limbs
+    size_t low_size = (size1 + 1) / 2;
+    size_t size = size1 + size2;
+    if (size2 <= low_size) {
+        // too unbalanced to split `num2`, so multiply it by each block of
+        // `num1` of its own length instead
+        std::fill(result, result + size, 0);
+        Limb* block_product = scratch;
+        for (size_t start = 0; start < size1; start += size2) {
+            size_t length = std::min(size2, size1 - start);
+            karatsuba_or_schoolbook(block_product, num1 + start, length,
+                                    num2, size2, scratch + 2 * size2);
+            add_limbs_at(result, size, start, block_product, length + size2);
+        }
+        return;
+    }
+
+    // the low and high partial products go straight into their places in
+    // the result
+    karatsuba_or_schoolbook(result, num1, low_size, num2, low_size, scratch);
+    karatsuba_or_schoolbook(result + 2 * low_size, num1 + low_size,
+                            size1 - low_size, num2 + low_size, size2 - low_size,
+                            scratch);
+
+    // the middle one is
+    //     prod_low + prod_high - (num1_low - num1_high) * (num2_low - num2_high)
+    // where the differences are computed as magnitudes (in `difference1` and
+    // `difference2`) so that their product needs no more limbs than its factors
+    Limb* difference1 = scratch;
+    Limb* difference2 = scratch + low_size;
+    Limb* prod_differences = scratch + 2 * low_size + 1;
+    bool negative = difference_limbs(difference1, num1, low_size,
+                                     num1 + low_size, size1 - low_size);
+    if (squaring) {
+        difference2 = difference1;
+        negative = false;
+    }
+    else
+        negative ^= difference_limbs(difference2, num2, low_size,
+                                     num2 + low_size, size2 - low_size);
+    karatsuba_or_schoolbook(prod_differences, difference1, low_size,
+                            difference2, low_size, scratch + 4 * low_size + 1);
+
+    // the differences are no longer needed, so their space holds the middle
+    // product, which is less than twice prod_low + prod_high
+    Limb* prod_mid = scratch;
+    prod_mid[2 * low_size] = add_limbs(prod_mid, result, 2 * low_size,
+                                       result + 2 * low_size, size - 2 * low_size);
+    if (negative)
+        add_limbs(prod_mid, prod_mid, 2 * low_size + 1, prod_differences, 2 * low_size);
+    else
+        subtract_limbs(prod_mid, prod_mid, 2 * low_size + 1, prod_differences,
+                       2 * low_size);
+
+    size_t mid_size = 2 * low_size + 1;
+    while (mid_size > 0 and prod_mid[mid_size - 1] == 0)
+        mid_size--;
+    add_limbs_at(result, size, low_size, prod_mid, mid_size);
+}
+
+
+/*
+    karatsuba_or_schoolbook
+    -----------------------
+    Stores the product of `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs) in the `size1 + size2` limbs of `result`, using the schoolbook
+    method below the Karatsuba thresholds, and karatsuba_limbs (with
+    `scratch`) otherwise.
+*/
+
+void karatsuba_or_schoolbook(Limb* result, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2, Limb* scratch) {
+    if (num1 == num2 and size1 == size2) {
+        if (size1 < SQUARE_KARATSUBA_THRESHOLD)
+            square_schoolbook(result, num1, size1);
+        else
+            karatsuba_limbs(result, num1, size1, num1, size1, scratch);
+    }
+    else if (std::min(size1, size2) < KARATSUBA_THRESHOLD)
+        multiply_schoolbook(result, num1, size1, num2, size2);
+    else
+        karatsuba_limbs(result, num1, size1, num2, size2, scratch);
+}
+
+
+/*
+    multiply_karatsuba
+    ------------------
+    Stores the product of `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs) in `product`, using Karatsuba's algorithm with a single scratch
+    area for the whole recursion.
+*/
+
+void multiply_karatsuba(LimbVector& product, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2) {
+    LimbVector scratch(karatsuba_scratch_size(std::max(size1, size2)));
+    product.resize(size1 + size2);
+    karatsuba_limbs(product.data(), num1, size1, num2, size2, scratch.data());
+}
+
+
+/*
+    evaluate_toom
+    -------------
+    Stores the value at the point `x` of the polynomial whose coefficients are
+    the `num_parts` parts (of `part_size` limbs each, except possibly the last)
+    of `num` (of `size` limbs) in `value`, which is given `part_size + 1` limbs.
+*/
+
+void evaluate_toom(LimbVector& value, const Limb* num, size_t size,
+        size_t part_size, size_t num_parts, Limb x) {
+    value.assign(part_size + 1, 0);
+    // Horner's method, starting with the most significant part
+    for (size_t i = num_parts; i-- > 0; ) {
+        // the value always fits, so there is never a carry out
+        multiply_by_limb(value.data(), value.data(), value.size(), x);
+        size_t start = std::min(i * part_size, size);
+        size_t length = std::min(part_size, size - start);
+        add_limbs_at(value.data(), value.size(), 0, num + start, length);
+    }
+}
+
+
+/*
+    multiply_toom
+    -------------
+    Stores the product of `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs, no more than `size1`) in `product`, using Toom-Cook multiplication
+    that splits the operands into `num_parts` (3 or 4) parts.
+    If both operands are the same, they are evaluated only once and every
+    pointwise product is a square.
+*/
+
+void multiply_toom(LimbVector& product, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2, size_t num_parts) {
+    size_t part_size = (size1 + num_parts - 1) / num_parts;
+    size_t num_points = 2 * num_parts - 1;      // including infinity
+    const long long* interpolation = num_parts == 3 ? &TOOM3_INTERPOLATION[0][0]
+                                                    : &TOOM4_INTERPOLATION[0][0];
+    Limb divisor = num_parts == 3 ? TOOM3_DIVISOR : TOOM4_DIVISOR;
+
+    // the products of the operands' values at each point, with the point at
+    // infinity last, which are independent of each other
+    std::vector<LimbVector> values(num_points);
+    size_t num2_top = std::min((num_parts - 1) * part_size, size2);
+    bool squaring = num1 == num2 and size1 == size2;
+    size_t max_parts = size2 >= PARALLEL_THRESHOLD ? num_points : 1;
+    parallel_for(num_points, max_parts, [&](size_t begin, size_t end) {
+        LimbVector value1, value2;
+        for (size_t x = begin; x < end; x++)
+            if (x == 0)
+                multiply_limbs(values[0], num1, part_size,
+                               num2, std::min(part_size, size2));
+            else if (x == num_points - 1)
+                multiply_limbs(values[x], num1 + (num_parts - 1) * part_size,
+                               size1 - (num_parts - 1) * part_size,
+                               num2 + num2_top, size2 - num2_top);
+            else {
+                evaluate_toom(value1, num1, size1, part_size, num_parts, (Limb) x);
+                if (!squaring)
+                    evaluate_toom(value2, num2, size2, part_size, num_parts, (Limb) x);
+                const LimbVector& other = squaring ? value1 : value2;
+                multiply_limbs(values[x], value1.data(), value1.size(),
+                               other.data(), other.size());
+            }
+    });
+
+    product.assign(size1 + size2, 0);
+    std::copy(values[0].begin(), values[0].end(), product.begin());
+    add_limbs_at(product.data(), product.size(), (num_points - 1) * part_size,
+                 values[num_points - 1].data(), values[num_points - 1].size());
+
+    // each remaining coefficient is a weighted sum of the values; its positive
+    // and negative terms are accumulated separately in `scratch1` and
+    // `scratch2`, so that only magnitudes are ever involved
+    LimbVector scratch1, scratch2;
+    size_t max_size = 0;
+    for (const LimbVector& value : values)
+        max_size = std::max(max_size, value.size());
+    for (size_t i = 0; i < num_points - 2; i++) {
+        scratch1.assign(max_size + 1, 0);
+        scratch2.assign(max_size + 1, 0);
+        for (size_t j = 0; j < num_points; j++) {
+            long long weight = interpolation[i * num_points + j];
+            LimbVector& terms = weight > 0 ? scratch1 : scratch2;
+            Limb carry = multiply_accumulate_limbs(terms.data(), values[j].data(),
+                    values[j].size(), (Limb) std::abs(weight));
+            add_limbs_at(terms.data(), terms.size(), values[j].size(), &carry, 1);
+        }
+        strip_leading_zero_limbs(scratch1);
+        strip_leading_zero_limbs(scratch2);
+        subtract_magnitudes(scratch1, scratch1, scratch2);
+        divide_by_limb(scratch1, divisor);
+        strip_leading_zero_limbs(scratch1);
+        add_limbs_at(product.data(), product.size(), (i + 1) * part_size,
+                     scratch1.data(), scratch1.size());
+    }
+}
+
+
+/*
+    square_limbs
+    ------------
+    Stores the square of `num` (of `size` limbs) in `square`, choosing the
+    algorithm by the operand's length.
+    NOTE: `square` should not share storage with the operand.
+*/
+
+void square_limbs(LimbVector& square, const Limb* num, size_t size) {
+    while (size > 0 and num[size - 1] == 0)
+        size--;
+
+    if (size == 0)
+        square.clear();
+    else if (size < SQUARE_KARATSUBA_THRESHOLD) {
+        square.resize(2 * size);
+        square_schoolbook(square.data(), num, size);
+    }
+    else if (size < SQUARE_TOOM3_THRESHOLD)
+        multiply_karatsuba(square, num, size, num, size);
+    else if (size < SQUARE_TOOM4_THRESHOLD)
+        multiply_toom(square, num, size, num, size, 3);
+    else if (size < SQUARE_NTT_THRESHOLD or 2 * size > NTT_MAX_LENGTH)
+        multiply_toom(square, num, size, num, size, 4);
+    else
+        multiply_ntt(square, num, size, num, size);
+
+    strip_leading_zero_limbs(square);
+}
+
+
+/*
+    multiply_unbalanced
+    -------------------
+    Stores the product of `num1` (of `size1` limbs) and the shorter `num2` (of
+    `size2` limbs) in `product`, by multiplying `num2` by each chunk of `num1`
+    of `chunk_size` limbs in turn, and adding up the products at their offsets.
+    When the chunks are split between threads, each one adds up the products
+    of its own chunks, and their sums are added up at the end.
+*/
+
+void multiply_unbalanced(LimbVector& product, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2, size_t chunk_size) {
+    size_t num_chunks = (size1 + chunk_size - 1) / chunk_size;
+    size_t max_parts = size2 >= PARALLEL_THRESHOLD ? num_chunks : 1;
+    // the sum of the products of the chunks from `begin`, at index `begin`
+    // (or `product` itself, when they are not split); `product` is only ever
+    // touched by this thread, since its storage belongs to this thread's
+    // LimbResource, while any range (even the first) may run on another one
+    std::vector<LimbVector> sums(max_parts > 1 ? num_chunks : 0);
+    parallel_for(num_chunks, max_parts, [&](size_t begin, size_t end) {
+        LimbVector& sum = sums.empty() ? product : sums[begin];
+        size_t offset = begin * chunk_size;
+        size_t stop = std::min(end * chunk_size, size1);
+        sum.assign(stop - offset + size2, 0);
+        LimbVector chunk_product;
+        for (size_t start = offset; start < stop; start += chunk_size) {
+            size_t length = std::min(chunk_size, stop - start);
+            multiply_limbs(chunk_product, num1 + start, length, num2, size2);
+            add_limbs_at(sum.data(), sum.size(), start - offset,
+                         chunk_product.data(), chunk_product.size());
+        }
+    });
+
+    if (!sums.empty())
+        product.assign(sums[0].begin(), sums[0].end());
+    product.resize(size1 + size2, 0);
+    for (size_t begin = 1; begin < sums.size(); begin++)
+        if (!sums[begin].empty())
+            add_limbs_at(product.data(), product.size(), begin * chunk_size,
+                         sums[begin].data(), sums[begin].size());
+}
+
+
+/*
+    multiply_limbs
+    --------------
+    Stores the product of `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs) in `product`, choosing the algorithm by the operands' lengths.
+    Squares, where both operands are the same, are computed by square_limbs.
+    An operand at least twice as long as the other one is multiplied in chunks
+    as long as the other one by Toom-Cook multiplication (so that its parts
+    are not mostly multiplied by zero), and in chunks as long as possible by
+    NTTs if the whole product is too long for them. Karatsuba's algorithm
+    splits such operands into chunks by itself.
+    NOTE: `product` should not share storage with either operand.
+*/
+
+void multiply_limbs(LimbVector& product, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2) {
+    // ignore leading zero limbs, which the parts of a split operand may have
+    while (size1 > 0 and num1[size1 - 1] == 0)
+        size1--;
+    while (size2 > 0 and num2[size2 - 1] == 0)
+        size2--;
+    if (size1 < size2) {
+        std::swap(num1, num2);
+        std::swap(size1, size2);
+    }
+
+    if (num1 == num2 and size1 == size2)
+        square_limbs(product, num1, size1);
+    else if (size2 == 0)
+        product.clear();
+    else if (size2 < KARATSUBA_THRESHOLD) {
+        product.resize(size1 + size2);
+        multiply_schoolbook(product.data(), num1, size1, num2, size2);
+    }
+    else if (size2 < TOOM3_THRESHOLD)
+        multiply_karatsuba(product, num1, size1, num2, size2);
+    else if (size2 < NTT_THRESHOLD and size1 >= 2 * size2)
+        multiply_unbalanced(product, num1, size1, num2, size2, size2);
+    else if (size2 < TOOM4_THRESHOLD)
+        multiply_toom(product, num1, size1, num2, size2, 3);
+    else if (size2 < NTT_THRESHOLD or 2 * size2 > NTT_MAX_LENGTH)
+        multiply_toom(product, num1, size1, num2, size2, 4);
+    else if (size1 + size2 > NTT_MAX_LENGTH)
+        multiply_unbalanced(product, num1, size1, num2, size2,
+                            NTT_MAX_LENGTH - size2);
+    else
+        multiply_ntt(product, num1, size1, num2, size2);
+
+    strip_leading_zero_limbs(product);
+}
+
+
+/*
+    assign_product (Integer)
+    ------------------------
+    Sets the BigInt to `num1 * num2`, multiplying by the integer's one or two
+    limbs in a single pass. `num1` may be the BigInt itself, which is then
+    multiplied in place by an integer that fits in a limb.
+*/
+
+void BigInt::assign_product(const BigInt& num1, const long long& num2) {
+    Limb multiplier[2];
+    size_t multiplier_size = magnitude_to_limbs(num2, multiplier);
+    char product_sign = (num1.sign == '-') != (num2 < 0) ? '-' : '+';
+
+    if (num1.limbs.empty() or multiplier_size == 0)
+        limbs.clear();
+    else if (multiplier_size == 1) {
+        if (this != &num1) {
+            limbs.reserve(num1.limbs.size() + 1);
+            limbs = num1.limbs;
+        }
+        Limb carry = multiply_by_limb(limbs.data(), limbs.data(), limbs.size(),
+                                      multiplier[0]);
+        if (carry)
+            limbs.push_back(carry);
+    }
+    else {
+        LimbVector product(num1.limbs.size() + multiplier_size);
+        multiply_schoolbook(product.data(), num1.limbs.data(), num1.limbs.size(),
+                            multiplier, multiplier_size);
+        strip_leading_zero_limbs(product);
+        limbs = std::move(product);
+    }
+
+    sign = limbs.empty() ? '+' : product_sign;
+}
+
+
+/*
+    accumulate_product
+    ------------------
+    Adds the product of the magnitudes `num1` (of `size1` limbs) and `num2` (of
+    `size2` limbs) to the BigInt, or subtracts it if `negative` is true, in
+    its own limbs. Products short enough for the schoolbook method are
+    accumulated row by row without any temporary; longer ones are computed
+    on their own and then added or subtracted. A difference that turns out
+    negative has wrapped around below zero, and is negated back.
+    NOTE: neither operand should share storage with the BigInt.
+*/
+
+void BigInt::accumulate_product(const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2, bool negative) {
+    while (size1 > 0 and num1[size1 - 1] == 0)
+        size1--;
+    while (size2 > 0 and num2[size2 - 1] == 0)
+        size2--;
+    if (size1 == 0 or size2 == 0)
+        return;
+    if (size1 < size2) {
+        std::swap(num1, num2);
+        std::swap(size1, size2);
+    }
+
+    char product_sign = negative ? '-' : '+';
+    if (limbs.empty())
+        sign = product_sign;
+    bool subtract = sign != product_sign;
+
+    // room for the product, and for the carry out of an addition
+    size_t size = std::max(limbs.size(), size1 + size2) + (subtract ? 0 : 1);
+    limbs.resize(size, 0);
+    Limb* result = limbs.data();
+    bool wrapped = false;
+    if (size2 < KARATSUBA_THRESHOLD) {
+        // one row per limb (or two limbs) of `num2`, each of which leaves a
+        // carry or borrow of as many limbs to settle above it
+        for (size_t i = 0; i < size2; ) {
+            Limb carry[2];
+            size_t carry_size = 1;
+#ifdef BIG_INT_WIDE_KERNELS
+            if (i + 2 <= size2) {
+                DoubleLimb multiplier = num2[i] | (DoubleLimb) num2[i + 1] << LIMB_BITS;
+                DoubleLimb double_carry = subtract
+                    ? multiply_subtract_double_limb(result + i, num1, size1, multiplier)
+                    : multiply_accumulate_double_limb(result + i, num1, size1, multiplier);
+                carry[0] = (Limb) double_carry;
+                carry[1] = (Limb) (double_carry >> LIMB_BITS);
+                carry_size = 2;
+            }
+            else
+#endif
+            carry[0] = subtract
+                ? multiply_subtract_limbs(result + i, num1, size1, num2[i])
+                : multiply_accumulate_limbs(result + i, num1, size1, num2[i]);
+
+            size_t offset = i + size1;
+            if (!subtract)
+                add_limbs_at(result, size, offset, carry, carry_size);
+            // once below zero, the difference only goes further below
+            else if (subtract_limbs(result + offset, result + offset, size - offset,
+                                    carry, carry_size))
+                wrapped = true;
+            i += carry_size;
+        }
+    }
+    else {
+        LimbVector product;
+        multiply_limbs(product, num1, size1, num2, size2);
+        if (!subtract)
+            add_limbs_at(result, size, 0, product.data(), product.size());
+        else
+            wrapped = subtract_limbs(result, result, size,
+                                     product.data(), product.size()) != 0;
+    }
+
+    if (wrapped) {
+        // the two's complement of the limbs is the magnitude of the difference
+        for (size_t i = 0; i < size; i++)
+            result[i] = ~result[i];
+        Limb one = 1;
+        add_limbs(result, result, size, &one, 1);
+        sign = product_sign;
+    }
+
+    strip_leading_zero_limbs(limbs);
+    if (limbs.empty())      // zero is never negative
+        sign = '+';
+}
+
+#endif  // BIG_INT_MULTIPLICATION_ALGORITHMS_HPP
@@ -0,0 +1,244 @@
+/*
+    ===========================================================================
+    Number-theoretic transform multiplication
+    ===========================================================================
+    The limbs of both operands are treated as the coefficients of polynomials,
+    whose product is computed as a cyclic convolution modulo three primes of
+    the form c * 2^k + 1, using number-theoretic transforms (NTTs). The
+    coefficients of the product are then recombined from their residues with
+    the Chinese remainder theorem and carried into limbs.
+    A coefficient is a sum of at most 2^22 products of two limbs, which is
+    less than the product of the three primes, so it is recovered exactly.
+*/
+
+#ifndef BIG_INT_NTT_ALGORITHMS_HPP
+#define BIG_INT_NTT_ALGORITHMS_HPP
+
+#include <algorithm>
+
+#include "BigInt.hpp"
+#include "algorithms/parallel.hpp"
+#include "algorithms/thresholds.hpp"
+
+// primes below 2^30, each with 3 as a primitive root
+const Limb NTT_PRIME1 = 469762049;     // 7 * 2^26 + 1
+const Limb NTT_PRIME2 = 167772161;     // 5 * 2^25 + 1
+const Limb NTT_PRIME3 = 998244353;     // 119 * 2^23 + 1
+const Limb NTT_PRIMITIVE_ROOT = 3;
+
+// the longest transform supported by all three primes, which bounds the
+// length (in limbs) of products that can be computed using NTTs
+const size_t NTT_MAX_LENGTH = (size_t) 1 << 23;
+
+// the fewest butterflies of a stage of a transform that are worth running on
+// a thread of their own
+const size_t NTT_PARALLEL_BUTTERFLIES = (size_t) 1 << 16;
+
+
+/*
+    multiply_mod
+    ------------
+    Returns (num1 * num2) mod MODULUS.
+*/
+
+template <Limb MODULUS>
+Limb multiply_mod(Limb num1, Limb num2) {
+    return (Limb) ((DoubleLimb) num1 * num2 % MODULUS);
+}
+
+
+/*
+    pow_mod
+    -------
+    Returns (base ^ exp) mod MODULUS.
+*/
+
+template <Limb MODULUS>
+Limb pow_mod(Limb base, DoubleLimb exp) {
+    Limb result = 1;
+    for (; exp; exp >>= 1) {
+        if (exp & 1)
+            result = multiply_mod<MODULUS>(result, base);
+        base = multiply_mod<MODULUS>(base, base);
+    }
+
+    return result;
+}
+
+
+/*
+    transform_ntt
+    -------------
+    Replaces `values` (whose length is a power of 2) with their number-theoretic
+    transform modulo MODULUS, or with their inverse transform if `inverse` is
+    true, using the iterative radix-2 Cooley-Tukey algorithm.
+*/
+
+template <Limb MODULUS>
+void transform_ntt(LimbVector& values, bool inverse) {
+    size_t length = values.size();
+
+    // bit-reversal permutation
+    for (size_t i = 1, j = 0; i < length; i++) {
+        size_t bit = length >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(values[i], values[j]);
+    }
+
+    // powers of a primitive (2 * half)-th root of unity for every stage, stored
+    // contiguously from roots[half], along with their Shoup precomputations
+    //     floor(root * 2^32 / MODULUS)
+    // which let a product modulo MODULUS be reduced without a division
+    LimbVector roots(std::max(length, (size_t) 2)), roots_shoup(roots.size());
+    for (size_t half = 1; half < length; half <<= 1) {
+        Limb root = pow_mod<MODULUS>(NTT_PRIMITIVE_ROOT, (MODULUS - 1) / (2 * half));
+        if (inverse)
+            root = pow_mod<MODULUS>(root, MODULUS - 2);
+        roots[half] = 1;
+        for (size_t j = 1; j < half; j++)
+            roots[half + j] = multiply_mod<MODULUS>(roots[half + j - 1], root);
+        for (size_t j = 0; j < half; j++)
+            roots_shoup[half + j] = (Limb) (((DoubleLimb) roots[half + j] << LIMB_BITS)
+                                            / MODULUS);
+    }
+
+    // butterflies, doubling the length of the sub-transforms at each stage;
+    // the butterflies of a stage are independent, so long transforms split
+    // them between threads
+    size_t num_butterflies = length / 2;
+    size_t max_parts = num_butterflies / NTT_PARALLEL_BUTTERFLIES;
+    Limb* data = values.data();
+    for (size_t half = 1, shift = 0; half < length; half <<= 1, shift++) {
+        const Limb* stage_roots = roots.data() + half;
+        const Limb* stage_roots_shoup = roots_shoup.data() + half;
+        parallel_for(num_butterflies, max_parts, [=](size_t begin, size_t end) {
+            // butterfly k combines values[i + j] and values[i + j + half],
+            // where i = 2 * half * (k / half) and j = k % half
+            for (size_t k = begin; k < end; ) {
+                size_t i = (k >> shift) << (shift + 1);
+                size_t j = k & (half - 1);
+                size_t block_end = std::min(half, j + (end - k));
+                k += block_end - j;
+                for (; j < block_end; j++) {
+                    Limb even = data[i + j];
+                    Limb odd_value = data[i + j + half];
+                    Limb quotient = (Limb) (((DoubleLimb) stage_roots_shoup[j]
+                                             * odd_value) >> LIMB_BITS);
+                    Limb odd = stage_roots[j] * odd_value - quotient * MODULUS;
+                    if (odd >= MODULUS)
+                        odd -= MODULUS;
+                    // the primes are below 2^30, so these never overflow a limb
+                    data[i + j] = even + odd >= MODULUS ? even + odd - MODULUS
+                                                        : even + odd;
+                    data[i + j + half] = even >= odd ? even - odd
+                                                     : even + MODULUS - odd;
+                }
+            }
+        });
+    }
+
+    if (inverse) {
+        Limb length_inverse = pow_mod<MODULUS>((Limb) (length % MODULUS), MODULUS - 2);
+        for (Limb& value : values)
+            value = multiply_mod<MODULUS>(value, length_inverse);
+    }
+}
+
+
+/*
+    convolve_ntt
+    ------------
+    Stores the cyclic convolution (of the given power-of-2 `length`) of `num1`
+    (of `size1` limbs) and `num2` (of `size2` limbs) modulo MODULUS in
+    `result`.
+*/
+
+template <Limb MODULUS>
+void convolve_ntt(LimbVector& result, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2, size_t length) {
+    result.assign(length, 0);
+    for (size_t i = 0; i < size1; i++)
+        result[i] = num1[i] % MODULUS;
+    transform_ntt<MODULUS>(result, false);
+
+    // a square needs only the one forward transform
+    if (num1 == num2 and size1 == size2)
+        for (size_t i = 0; i < length; i++)
+            result[i] = multiply_mod<MODULUS>(result[i], result[i]);
+    else {
+        LimbVector transform2(length, 0);
+        for (size_t i = 0; i < size2; i++)
+            transform2[i] = num2[i] % MODULUS;
+        transform_ntt<MODULUS>(transform2, false);
+        for (size_t i = 0; i < length; i++)
+            result[i] = multiply_mod<MODULUS>(result[i], transform2[i]);
+    }
+    transform_ntt<MODULUS>(result, true);
+}
+
+
+/*
+    multiply_ntt
+    ------------
+    Stores the product of `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs) in `product`, using number-theoretic transforms.
+    NOTE: the product should be no longer than NTT_MAX_LENGTH limbs.
+*/
+
+void multiply_ntt(LimbVector& product, const Limb* num1, size_t size1,
+        const Limb* num2, size_t size2) {
+    size_t length = 1;
+    while (length < size1 + size2)
+        length <<= 1;
+
+    // the convolutions modulo each prime are independent of each other
+    LimbVector residues1, residues2, residues3;
+    size_t max_parts = std::min(size1, size2) >= PARALLEL_THRESHOLD ? 3 : 1;
+    parallel_for(3, max_parts, [&](size_t begin, size_t end) {
+        for (size_t prime = begin; prime < end; prime++)
+            if (prime == 0)
+                convolve_ntt<NTT_PRIME1>(residues1, num1, size1, num2, size2, length);
+            else if (prime == 1)
+                convolve_ntt<NTT_PRIME2>(residues2, num1, size1, num2, size2, length);
+            else
+                convolve_ntt<NTT_PRIME3>(residues3, num1, size1, num2, size2, length);
+    });
+
+    // constants for Garner's algorithm
+    const Limb prime1_inverse = pow_mod<NTT_PRIME2>(NTT_PRIME1 % NTT_PRIME2,
+                                                    NTT_PRIME2 - 2);
+    const DoubleLimb prime12 = (DoubleLimb) NTT_PRIME1 * NTT_PRIME2;
+    const Limb prime12_inverse = pow_mod<NTT_PRIME3>((Limb) (prime12 % NTT_PRIME3),
+                                                     NTT_PRIME3 - 2);
+    const DoubleLimb limb_mask = ((DoubleLimb) 1 << LIMB_BITS) - 1;
+
+    product.resize(size1 + size2);
+    DoubleLimb carry = 0;
+    for (size_t i = 0; i < product.size(); i++) {
+        // recombine the coefficient as
+        //     residue1 + prime1 * digit2 + prime1 * prime2 * digit3
+        Limb residue1 = residues1[i];
+        Limb digit2 = multiply_mod<NTT_PRIME2>(
+                (residues2[i] + NTT_PRIME2 - residue1 % NTT_PRIME2) % NTT_PRIME2,
+                prime1_inverse);
+        DoubleLimb low = residue1 + (DoubleLimb) NTT_PRIME1 * digit2;
+        Limb digit3 = multiply_mod<NTT_PRIME3>(
+                (residues3[i] + NTT_PRIME3 - (Limb) (low % NTT_PRIME3)) % NTT_PRIME3,
+                prime12_inverse);
+        DoubleLimb high_low = (prime12 & limb_mask) * digit3;
+        DoubleLimb high_high = (prime12 >> LIMB_BITS) * digit3;
+
+        // add the coefficient to the carry from the lower limbs, and keep
+        // everything above the current limb as the next carry
+        DoubleLimb sum = (carry & limb_mask) + (low & limb_mask)
+                         + (high_low & limb_mask);
+        product[i] = (Limb) sum;
+        carry = (carry >> LIMB_BITS) + (low >> LIMB_BITS) + (high_low >> LIMB_BITS)
+                + high_high + (sum >> LIMB_BITS);
+    }
+}
+
+#endif  // BIG_INT_NTT_ALGORITHMS_HPP
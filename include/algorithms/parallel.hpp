@@ -0,0 +1,141 @@
+/*
+    ===========================================================================
+    Parallel multiplication
+    ===========================================================================
+    Multiplications of operands of at least PARALLEL_THRESHOLD limbs can split
+    their independent parts (the pointwise products of Toom-Cook
+    multiplication, the chunks of unbalanced products, and the convolutions
+    and butterflies of NTTs) between several threads. This is opt-in: threads
+    are only ever started when BIG_INT_ENABLE_THREADS is defined before BigInt
+    is included (which may need linking with -pthread), and when the number of
+    threads has been raised above 1 by set_multiplication_threads.
+    Threads are started for each part, and only while fewer than that number
+    are working on multiplications overall, so nested parallel parts never
+    oversubscribe the machine. Each thread allocates limbs from the heap,
+    since the LimbResource of the thread that started it is not thread-safe.
+*/
+
+#ifndef BIG_INT_PARALLEL_ALGORITHMS_HPP
+#define BIG_INT_PARALLEL_ALGORITHMS_HPP
+
+#include <cstddef>
+
+#ifdef BIG_INT_ENABLE_THREADS
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+
+/*
+    available_threads
+    -----------------
+    Returns the number of threads that multiplications may start in addition
+    to the ones that are already working on them.
+*/
+
+std::atomic<int>& available_threads() {
+    static std::atomic<int> threads(0);
+    return threads;
+}
+
+
+/*
+    set_multiplication_threads
+    --------------------------
+    Sets the number of threads (including the calling one) that multiplications
+    may use, which is 1 by default, or all of the hardware threads if it is 0.
+*/
+
+void set_multiplication_threads(unsigned threads) {
+    static std::mutex mutex;
+    static unsigned current_threads = 1;
+
+    if (threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    // threads that are still working give themselves back when they finish,
+    // so only the difference is applied
+    std::lock_guard<std::mutex> lock(mutex);
+    available_threads() += (int) threads - (int) current_threads;
+    current_threads = threads;
+}
+
+
+/*
+    acquire_thread
+    --------------
+    Takes one of the available threads, and returns whether there was one.
+*/
+
+bool acquire_thread() {
+    int threads = available_threads().load();
+    while (threads > 0)
+        if (available_threads().compare_exchange_weak(threads, threads - 1))
+            return true;
+
+    return false;
+}
+
+
+// gives an acquired thread back once the part that it ran is done
+struct ThreadRelease {
+    ~ThreadRelease() {
+        available_threads()++;
+    }
+};
+#endif  // BIG_INT_ENABLE_THREADS
+
+
+/*
+    parallel_for
+    ------------
+    Calls `function(begin, end)` for consecutive ranges that together cover
+    [0, count), one per thread, splitting it into as many as `max_parts` ranges
+    as there are threads available, and returns once all of them are done.
+    Without BIG_INT_ENABLE_THREADS, it simply calls `function(0, count)`.
+*/
+
+template <typename Function>
+void parallel_for(size_t count, size_t max_parts, const Function& function) {
+#ifdef BIG_INT_ENABLE_THREADS
+    size_t num_threads = 0;
+    while (num_threads + 1 < std::min(max_parts, count) and acquire_thread())
+        num_threads++;
+
+    if (num_threads > 0) {
+        // the calling thread runs the last range itself
+        size_t num_parts = num_threads + 1;
+        std::vector<std::future<void>> parts;
+        for (size_t part = 0; part < num_threads; part++) {
+            size_t begin = count * part / num_parts;
+            size_t end = count * (part + 1) / num_parts;
+            try {
+                parts.push_back(std::async(std::launch::async,
+                        [&function, begin, end] {
+                            ThreadRelease release;
+                            function(begin, end);
+                        }));
+            }
+            catch (const std::system_error&) {
+                // no thread could be started, so run the range here instead
+                available_threads()++;
+                function(begin, end);
+            }
+        }
+        function(count * num_threads / num_parts, count);
+
+        for (std::future<void>& part : parts)
+            part.get();
+        return;
+    }
+#else
+    (void) max_parts;
+#endif
+
+    function(0, count);
+}
+
+#endif  // BIG_INT_PARALLEL_ALGORITHMS_HPP
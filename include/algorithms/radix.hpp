@@ -0,0 +1,662 @@
+/*
+    ===========================================================================
+    Radix conversion
+    ===========================================================================
+    Strings of digits in any base from 2 to 36 are converted to limbs, and
+    back. In a base that is a power of 2, each digit stands for a fixed group
+    of bits, which are simply copied, in linear time.
+    In every other base, conversions go by divide and conquer. For a string,
+    the digits are split at a power of the base of the form base^(k * 2^j),
+    where base^k is the largest power of the base that fits in a limb. Both
+    halves are converted separately, and the upper one is multiplied by that
+    power (using the fastest multiplication for its length) and added to the
+    lower one. For limbs, the number is divided by such a power (using the
+    fastest division for its length), and the digits of the quotient are
+    followed by those of the remainder, padded with leading zeros to
+    k * 2^j digits.
+    The cost of a conversion is then dominated by that of a few
+    multiplications or divisions as long as the number, instead of the
+    quadratic cost of going through it digit by digit. Numbers shorter than
+    FROM_STRING_THRESHOLD or TO_STRING_THRESHOLD limbs (at k digits per limb)
+    are converted digit by digit: strings in chunks as long as fit in a limb,
+    or in a word of limbs with the wide kernels, and limbs in chunks of k
+    digits. Decimal chunks are peeled off by dividing by a constant, which
+    compilers replace with a multiplication, and formatted two digits at a
+    time.
+    The powers of each base are computed once, by repeated squaring, and
+    cached for all later conversions.
+    Digits that arrive one at a time (such as from a stream) are gathered in
+    blocks that span such a power, and each block is converted as soon as it
+    is full, so that the whole string is never held at once.
+*/
+
+#ifndef BIG_INT_RADIX_ALGORITHMS_HPP
+#define BIG_INT_RADIX_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "BigInt.hpp"
+#include "algorithms/addition.hpp"
+#include "algorithms/division.hpp"
+#include "algorithms/multiplication.hpp"
+#include "algorithms/thresholds.hpp"
+#include "functions/utility.hpp"
+
+// the characters of the digits in every base, in the order of their values
+const char DIGIT_CHARACTERS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// the pairs of digits from "00" to "99", for formatting two digits at a time
+const char DIGIT_PAIRS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// digits that arrive one at a time are converted in blocks of at least this
+// many
+const size_t STREAM_BLOCK_DIGITS = 4096;
+
+
+/*
+    radix_chunk
+    -----------
+    Returns the largest power of `base` that fits in a limb, and stores its
+    exponent, the number of digits in a chunk of that many, in `chunk_digits`.
+*/
+
+Limb radix_chunk(int base, size_t& chunk_digits) {
+    DoubleLimb chunk = base;
+    for (chunk_digits = 1; chunk * base <= (Limb) -1; chunk_digits++)
+        chunk *= base;
+
+    return (Limb) chunk;
+}
+
+
+/*
+    radix_bits
+    ----------
+    Returns the number of bits that a digit in `base` stands for, if the base
+    is a power of 2, or 0 if it is not.
+*/
+
+int radix_bits(int base) {
+    if (base & (base - 1))
+        return 0;
+
+    int bits = 0;
+    while ((1 << bits) < base)
+        bits++;
+
+    return bits;
+}
+
+#ifdef BIG_INT_WIDE_KERNELS
+
+
+/*
+    radix_word_chunk
+    ----------------
+    Returns the largest power of `base` that fits in a word, and stores its
+    exponent in `chunk_digits`.
+*/
+
+Word radix_word_chunk(int base, size_t& chunk_digits) {
+    Word chunk = base;
+    for (chunk_digits = 1; chunk <= (Word) -1 / base; chunk_digits++)
+        chunk *= base;
+
+    return chunk;
+}
+
+
+/*
+    multiply_and_add_word
+    ---------------------
+    Replaces a magnitude `num` with `num * multiplier + addend`, two limbs at a
+    time.
+*/
+
+void multiply_and_add_word(LimbVector& num, Word multiplier, Word addend) {
+    // at most (2^64 - 1)^2 + 2^64 - 1, so the carry always fits in a word
+    DoubleWord carry = addend;
+    size_t i = 0;
+    for (; i + 2 <= num.size(); i += 2) {
+        carry += (DoubleWord) load_word(num.data() + i) * multiplier;
+        store_word(num.data() + i, (Word) carry);
+        carry >>= WORD_BITS;
+    }
+    if (i < num.size()) {
+        carry += (DoubleWord) num[i] * multiplier;
+        num[i] = (Limb) carry;
+        carry >>= LIMB_BITS;
+    }
+    for (; carry; carry >>= LIMB_BITS)
+        num.push_back((Limb) carry);
+}
+#endif  // BIG_INT_WIDE_KERNELS
+
+
+/*
+    radix_power
+    -----------
+    Returns chunk^(2^level), where chunk is the largest power of `base` that
+    fits in a limb, from a cache that is shared by all threads and grows as
+    longer powers are needed. The powers are allocated from the heap, whatever
+    the current limb resource is, since they outlive any conversion.
+*/
+
+const LimbVector& radix_power(int base, size_t level) {
+    // the heap resource is constructed before the cache, so that it is still
+    // there when the cache is destroyed; and a deque never moves its
+    // elements, so references to them stay valid as it grows
+    static LimbResource* heap_resource = heap_limb_resource();
+    static std::deque<LimbVector> powers[MAX_BASE + 1];
+    static std::mutex mutex;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    LimbResourceScope heap_scope(heap_resource);
+    std::deque<LimbVector>& base_powers = powers[base];
+    if (base_powers.empty()) {
+        size_t chunk_digits;
+        base_powers.push_back(LimbVector(1, radix_chunk(base, chunk_digits)));
+    }
+    while (base_powers.size() <= level) {
+        const LimbVector& last = base_powers.back();
+        LimbVector square;
+        square_limbs(square, last.data(), last.size());
+        base_powers.push_back(std::move(square));
+    }
+
+    return base_powers[level];
+}
+
+
+/*
+    digits_to_limbs_binary
+    ----------------------
+    Stores the magnitude of the digits `digits` (of `length` characters) in
+    `result`, where each digit stands for `bits` bits, starting with the least
+    significant digit.
+*/
+
+void digits_to_limbs_binary(LimbVector& result, const char* digits,
+        size_t length, int bits) {
+    result.resize((length * bits + LIMB_BITS - 1) / LIMB_BITS);
+    // the bits of the digits are gathered until they fill a limb, so a digit
+    // may straddle two limbs
+    DoubleLimb buffer = 0;
+    int buffered_bits = 0;
+    size_t limb = 0;
+    for (size_t i = length; i-- > 0; ) {
+        buffer |= (DoubleLimb) digit_value(digits[i]) << buffered_bits;
+        buffered_bits += bits;
+        if (buffered_bits >= LIMB_BITS) {
+            result[limb++] = (Limb) buffer;
+            buffer >>= LIMB_BITS;
+            buffered_bits -= LIMB_BITS;
+        }
+    }
+    if (buffered_bits > 0)
+        result[limb] = (Limb) buffer;
+    strip_leading_zero_limbs(result);
+}
+
+
+/*
+    digits_to_limbs_schoolbook
+    --------------------------
+    Stores the magnitude of the digits `digits` (of `length` characters) in
+    `base` in `result`, chunk by chunk, starting with the leading chunk that
+    holds the leftover digits.
+*/
+
+void digits_to_limbs_schoolbook(LimbVector& result, const char* digits,
+        size_t length, int base) {
+    size_t chunk_digits;
+#ifdef BIG_INT_WIDE_KERNELS
+    Word chunk_power = radix_word_chunk(base, chunk_digits);
+#else
+    Limb chunk_power = radix_chunk(base, chunk_digits);
+#endif
+
+    result.clear();
+    size_t chunk_length = length % chunk_digits;
+    if (chunk_length == 0)
+        chunk_length = chunk_digits;
+    for (size_t i = 0; i < length; i += chunk_length, chunk_length = chunk_digits) {
+        unsigned long long chunk = 0;
+        for (size_t j = i; j < i + chunk_length; j++)
+            chunk = chunk * base + digit_value(digits[j]);
+#ifdef BIG_INT_WIDE_KERNELS
+        multiply_and_add_word(result, chunk_power, chunk);
+#else
+        multiply_and_add_limb(result, chunk_power, (Limb) chunk);
+#endif
+    }
+    strip_leading_zero_limbs(result);
+}
+
+
+/*
+    combine_digit_parts
+    -------------------
+    Stores `upper * power + lower` in `result`, where `upper` and `lower` are
+    the magnitudes of the digits above and below those spanned by `power`, a
+    power of their base. The result must not be one of the other arguments.
+*/
+
+void combine_digit_parts(LimbVector& result, const LimbVector& upper,
+        const LimbVector& power, const LimbVector& lower) {
+    multiply_limbs(result, upper.data(), upper.size(), power.data(), power.size());
+    // the upper part is zero if all of its digits are leading zeros
+    if (result.size() <= lower.size())
+        result.resize(lower.size() + 1);
+    else
+        result.push_back(0);
+    add_limbs(result.data(), result.data(), result.size(), lower.data(),
+              lower.size());
+    strip_leading_zero_limbs(result);
+}
+
+
+/*
+    digits_to_limbs_halves
+    ----------------------
+    Stores the magnitude of the digits `digits` (of `length` characters, more
+    than in a chunk of them) in `base` in `result`, splitting them at the
+    longest cached power of the base that leaves some digits above it, so that
+    the lower part is at least as long as the upper one, and converting both
+    parts recursively.
+*/
+
+void digits_to_limbs(LimbVector&, const char*, size_t, int);
+
+void digits_to_limbs_halves(LimbVector& result, const char* digits,
+        size_t length, int base) {
+    size_t chunk_digits;
+    radix_chunk(base, chunk_digits);
+    size_t level = 0;
+    while ((chunk_digits << (level + 1)) < length)
+        level++;
+    size_t lower_length = chunk_digits << level;
+
+    LimbVector upper, lower;
+    digits_to_limbs(upper, digits, length - lower_length, base);
+    digits_to_limbs(lower, digits + length - lower_length, lower_length, base);
+
+    combine_digit_parts(result, upper, radix_power(base, level), lower);
+}
+
+
+/*
+    digits_to_limbs
+    ---------------
+    Stores the magnitude of the digits `digits` (of `length` characters) in
+    `base` in `result`, choosing the algorithm by the base and their length.
+    NOTE: the digits should be valid in the base.
+*/
+
+void digits_to_limbs(LimbVector& result, const char* digits, size_t length,
+        int base) {
+    size_t chunk_digits;
+    radix_chunk(base, chunk_digits);
+
+    if (int bits = radix_bits(base))
+        digits_to_limbs_binary(result, digits, length, bits);
+    else if (length <= FROM_STRING_THRESHOLD * chunk_digits)
+        digits_to_limbs_schoolbook(result, digits, length, base);
+    else
+        digits_to_limbs_halves(result, digits, length, base);
+}
+
+
+/*
+    DigitAccumulator
+    ----------------
+    Converts digits in some base to limbs as they arrive one at a time (such
+    as from a stream), without ever holding more than a block of them. In a
+    base that is a power of 2, their bits are packed into limbs as they
+    arrive. In any other base, each full block is converted by itself, and
+    the last two blocks are combined whenever they span the same power of the
+    base (like the carries of a binary counter), so that long strings are
+    still converted by divide and conquer.
+*/
+
+class DigitAccumulator {
+    int base;
+    int bits;                   // per digit, if the base is a power of 2
+    size_t block_level;         // a full block spans radix_power(base, block_level)
+    size_t block_size;
+    size_t block_length;
+    char block[2 * STREAM_BLOCK_DIGITS];
+    // the converted blocks, most significant first, with the levels of the
+    // powers they span (which decrease from one to the next):
+    std::vector<LimbVector> parts;
+    std::vector<size_t> levels;
+    // the bits of the digits in a power-of-2 base, most significant first:
+    LimbVector packed;
+    DoubleLimb buffer;
+    int buffered_bits;
+
+    void convert_block();
+
+    public:
+        explicit DigitAccumulator(int);
+        void push_back(char);
+        void finish(LimbVector&);
+};
+
+
+/*
+    DigitAccumulator constructor
+    ----------------------------
+    Prepares to accumulate digits in `base`, with blocks of the fewest chunks
+    of digits that span a cached power of the base and hold at least
+    STREAM_BLOCK_DIGITS digits.
+*/
+
+DigitAccumulator::DigitAccumulator(int base) : base(base),
+        bits(radix_bits(base)), block_level(0), block_length(0), buffer(0),
+        buffered_bits(0) {
+    radix_chunk(base, block_size);
+    while (block_size < STREAM_BLOCK_DIGITS) {
+        block_size <<= 1;
+        block_level++;
+    }
+}
+
+
+/*
+    DigitAccumulator::push_back
+    ---------------------------
+    Appends a digit, which should be valid in the base, as the least
+    significant one.
+*/
+
+void DigitAccumulator::push_back(char digit) {
+    if (bits) {
+        // the bits of the digits are gathered until they fill a limb, so a
+        // digit may straddle two limbs
+        buffer = (buffer << bits) | (DoubleLimb) digit_value(digit);
+        buffered_bits += bits;
+        if (buffered_bits >= LIMB_BITS) {
+            buffered_bits -= LIMB_BITS;
+            packed.push_back((Limb) (buffer >> buffered_bits));
+        }
+        return;
+    }
+
+    block[block_length++] = digit;
+    if (block_length == block_size)
+        convert_block();
+}
+
+
+/*
+    DigitAccumulator::convert_block
+    -------------------------------
+    Converts the full block of digits, and combines it with the blocks before
+    it while the last two span the same power of the base.
+*/
+
+void DigitAccumulator::convert_block() {
+    parts.push_back(LimbVector());
+    levels.push_back(block_level);
+    digits_to_limbs(parts.back(), block, block_length, base);
+    block_length = 0;
+
+    while (levels.size() >= 2 and levels[levels.size() - 2] == levels.back()) {
+        size_t level = levels.back();
+        LimbVector combined;
+        combine_digit_parts(combined, parts[parts.size() - 2],
+                            radix_power(base, level), parts.back());
+        parts.pop_back();
+        levels.pop_back();
+        parts.back().swap(combined);
+        levels.back() = level + 1;
+    }
+}
+
+
+/*
+    DigitAccumulator::finish
+    ------------------------
+    Stores the magnitude of all the digits appended in `result`.
+*/
+
+void DigitAccumulator::finish(LimbVector& result) {
+    if (bits) {
+        // the last limb is filled from the top, so the limbs (reversed to be
+        // least significant first) are shifted down by the bits left empty
+        int empty_bits = 0;
+        if (buffered_bits > 0) {
+            empty_bits = LIMB_BITS - buffered_bits;
+            packed.push_back((Limb) (buffer << empty_bits));
+        }
+        std::reverse(packed.begin(), packed.end());
+        shift_limbs_right(packed.data(), packed.data(), packed.size(),
+                          empty_bits);
+        strip_leading_zero_limbs(packed);
+        result.swap(packed);
+        return;
+    }
+
+    LimbVector lower;
+    digits_to_limbs(lower, block, block_length, base);
+    if (parts.empty()) {
+        result.swap(lower);
+        return;
+    }
+
+    // the last block spans base^block_length
+    size_t chunk_digits;
+    Limb chunk = radix_chunk(base, chunk_digits);
+    LimbVector power(1, 1);
+    size_t length = block_length;
+    for (; length >= chunk_digits; length -= chunk_digits)
+        multiply_and_add_limb(power, chunk, 0);
+    Limb rest = 1;
+    for (; length > 0; length--)
+        rest *= base;
+    multiply_and_add_limb(power, rest, 0);
+
+    // the full blocks are combined with it least significant first, with the
+    // power spanned by the digits below each one, so that the longest block
+    // is multiplied only once
+    LimbVector combined;
+    for (size_t i = parts.size(); i-- > 0; ) {
+        combine_digit_parts(combined, parts[i], power, lower);
+        lower.swap(combined);
+        if (i > 0) {
+            const LimbVector& block_power = radix_power(base, levels[i]);
+            multiply_limbs(combined, power.data(), power.size(),
+                           block_power.data(), block_power.size());
+            power.swap(combined);
+        }
+    }
+    result.swap(lower);
+}
+
+
+/*
+    limbs_to_digits_binary
+    ----------------------
+    Appends the digits of `num` (of `size` limbs) in `base`, a power of 2 in
+    which each digit stands for `bits` bits, to `result`, padded with leading
+    zeros to `width` digits if there are fewer of them.
+*/
+
+void limbs_to_digits_binary(std::string& result, const Limb* num, size_t size,
+        size_t width, int bits) {
+    while (size > 0 and num[size - 1] == 0)
+        size--;
+
+    size_t num_bits = size * LIMB_BITS;
+    if (size > 0)
+        for (Limb top = num[size - 1]; !(top >> (LIMB_BITS - 1)); top <<= 1)
+            num_bits--;
+    size_t num_digits = (num_bits + bits - 1) / bits;
+    if (width > num_digits)
+        result.append(width - num_digits, '0');
+
+    Limb mask = ((Limb) 1 << bits) - 1;
+    for (size_t i = num_digits; i-- > 0; ) {
+        // a digit may straddle two limbs
+        size_t bit = i * bits, limb = bit / LIMB_BITS;
+        DoubleLimb window = num[limb];
+        if (limb + 1 < size)
+            window |= (DoubleLimb) num[limb + 1] << LIMB_BITS;
+        result += DIGIT_CHARACTERS[(window >> (bit % LIMB_BITS)) & mask];
+    }
+}
+
+
+/*
+    divide_by_decimal_chunk
+    -----------------------
+    Divides a magnitude `num` by 10^9 in place, and returns the remainder. The
+    divisor is a constant, unlike in divide_by_limb, so the division compiles
+    to a multiplication.
+*/
+
+Limb divide_by_decimal_chunk(LimbVector& num) {
+    DoubleLimb remainder = 0;
+    for (size_t i = num.size(); i-- > 0; ) {
+        remainder = (remainder << LIMB_BITS) | num[i];
+        num[i] = (Limb) (remainder / DECIMAL_CHUNK);
+        remainder %= DECIMAL_CHUNK;
+    }
+
+    return (Limb) remainder;
+}
+
+
+/*
+    format_chunk
+    ------------
+    Writes the `chunk_digits` digits of `chunk` in `base`, padded with leading
+    zeros, to `digits`.
+*/
+
+void format_chunk(char* digits, Limb chunk, int base, size_t chunk_digits) {
+    size_t i = chunk_digits;
+    if (base == 10)
+        for (; i >= 2; i -= 2) {
+            std::memcpy(digits + i - 2, DIGIT_PAIRS + 2 * (chunk % 100), 2);
+            chunk /= 100;
+        }
+    for (; i-- > 0; chunk /= base)
+        digits[i] = DIGIT_CHARACTERS[chunk % base];
+}
+
+
+/*
+    limbs_to_digits_schoolbook
+    --------------------------
+    Appends the digits of `num` (of `size` limbs) in `base` to `result`, padded
+    with leading zeros to `width` digits if there are fewer of them, by
+    peeling off chunks of digits, least significant first.
+*/
+
+void limbs_to_digits_schoolbook(std::string& result, const Limb* num,
+        size_t size, size_t width, int base) {
+    size_t chunk_digits;
+    Limb chunk_power = radix_chunk(base, chunk_digits);
+
+    LimbVector magnitude(num, num + size), chunks;
+    strip_leading_zero_limbs(magnitude);
+    while (!magnitude.empty()) {
+        chunks.push_back(base == 10 ? divide_by_decimal_chunk(magnitude)
+                                    : divide_by_limb(magnitude, chunk_power));
+        if (magnitude.back() == 0)
+            magnitude.pop_back();
+    }
+
+    if (chunks.empty()) {       // zero has no digits, except for padding
+        result.append(width, '0');
+        return;
+    }
+
+    // only the leading chunk is not padded with zeros
+    char leading_chunk[LIMB_BITS];
+    format_chunk(leading_chunk, chunks.back(), base, chunk_digits);
+    size_t leading_zeros = 0;
+    while (leading_chunk[leading_zeros] == '0')
+        leading_zeros++;
+    size_t num_digits = chunks.size() * chunk_digits - leading_zeros;
+    if (width > num_digits)
+        result.append(width - num_digits, '0');
+
+    result.append(leading_chunk + leading_zeros, chunk_digits - leading_zeros);
+    size_t offset = result.size();
+    result.resize(offset + (chunks.size() - 1) * chunk_digits);
+    for (size_t i = chunks.size() - 1; i-- > 0; offset += chunk_digits)
+        format_chunk(&result[offset], chunks[i], base, chunk_digits);
+}
+
+
+/*
+    limbs_to_digits_halves
+    ----------------------
+    Appends the digits of `num` (of `size` limbs, at least 2) in `base` to
+    `result`, padded with leading zeros to `width` digits if there are fewer
+    of them, by dividing it by the longest cached power of the base that is
+    certainly less than it, and converting the quotient and the remainder
+    recursively.
+*/
+
+void limbs_to_digits(std::string&, const Limb*, size_t, size_t, int);
+
+void limbs_to_digits_halves(std::string& result, const Limb* num, size_t size,
+        size_t width, int base) {
+    while (size > 0 and num[size - 1] == 0)
+        size--;
+
+    // the number is at least 2^(32 * (size - 1)), which has more digits than
+    // this (with a margin for rounding errors)
+    double digits_per_limb = LIMB_BITS * std::log(2.0) / std::log((double) base);
+    size_t min_digits = (size_t) ((size - 1) * digits_per_limb * 0.9999) + 1;
+    size_t chunk_digits;
+    radix_chunk(base, chunk_digits);
+    size_t level = 0;
+    while ((chunk_digits << (level + 1)) < min_digits)
+        level++;
+    size_t lower_width = chunk_digits << level;
+
+    const LimbVector& power = radix_power(base, level);
+    LimbVector quotient, remainder;
+    divide_limbs(quotient, remainder, num, size, power.data(), power.size());
+
+    limbs_to_digits(result, quotient.data(), quotient.size(),
+                    width > lower_width ? width - lower_width : 0, base);
+    limbs_to_digits(result, remainder.data(), remainder.size(), lower_width, base);
+}
+
+
+/*
+    limbs_to_digits
+    ---------------
+    Appends the digits of `num` (of `size` limbs) in `base` to `result`, padded
+    with leading zeros to `width` digits if there are fewer of them, choosing
+    the algorithm by the base and its length.
+*/
+
+void limbs_to_digits(std::string& result, const Limb* num, size_t size,
+        size_t width, int base) {
+    if (int bits = radix_bits(base))
+        limbs_to_digits_binary(result, num, size, width, bits);
+    else if (size <= TO_STRING_THRESHOLD)
+        limbs_to_digits_schoolbook(result, num, size, width, base);
+    else
+        limbs_to_digits_halves(result, num, size, width, base);
+}
+
+#endif  // BIG_INT_RADIX_ALGORITHMS_HPP
@@ -0,0 +1,111 @@
+/*
+    ===========================================================================
+    Algorithm thresholds
+    ===========================================================================
+    The lengths (in limbs) at which each algorithm for multiplication, squaring,
+    division and conversion from and to strings takes over from the one before it,
+    and from which the parts of a product are computed by several threads, if
+    they are enabled.
+    Every threshold can be overridden by defining a macro of the same name,
+    prefixed by BIG_INT_, before BigInt is included, e.g.
+        #define BIG_INT_KARATSUBA_THRESHOLD 40
+    Definitions of all of them, tuned for the machine that runs it, are
+    printed by the `Tune` program. They are included from a header when
+    BIG_INT_TUNING_HEADER is defined as its path, e.g.
+        g++ -DBIG_INT_TUNING_HEADER='"tuned_thresholds.hpp"' ...
+*/
+
+#ifndef BIG_INT_THRESHOLDS_HPP
+#define BIG_INT_THRESHOLDS_HPP
+
+#include <cstddef>
+
+#include "algorithms/words.hpp"
+
+#ifdef BIG_INT_TUNING_HEADER
+#include BIG_INT_TUNING_HEADER
+#endif
+
+// multiplication (the schoolbook method goes on for longer when it multiplies
+// words of limbs):
+#ifndef BIG_INT_KARATSUBA_THRESHOLD
+#ifdef BIG_INT_WIDE_KERNELS
+#define BIG_INT_KARATSUBA_THRESHOLD 64
+#else
+#define BIG_INT_KARATSUBA_THRESHOLD 32
+#endif
+#endif
+#ifndef BIG_INT_TOOM3_THRESHOLD
+#define BIG_INT_TOOM3_THRESHOLD 300
+#endif
+#ifndef BIG_INT_TOOM4_THRESHOLD
+#define BIG_INT_TOOM4_THRESHOLD 2000
+#endif
+#ifndef BIG_INT_NTT_THRESHOLD
+#define BIG_INT_NTT_THRESHOLD 6000
+#endif
+
+// squaring:
+#ifndef BIG_INT_SQUARE_KARATSUBA_THRESHOLD
+#ifdef BIG_INT_WIDE_KERNELS
+#define BIG_INT_SQUARE_KARATSUBA_THRESHOLD 112
+#else
+#define BIG_INT_SQUARE_KARATSUBA_THRESHOLD 80
+#endif
+#endif
+#ifndef BIG_INT_SQUARE_TOOM3_THRESHOLD
+#define BIG_INT_SQUARE_TOOM3_THRESHOLD 400
+#endif
+#ifndef BIG_INT_SQUARE_TOOM4_THRESHOLD
+#define BIG_INT_SQUARE_TOOM4_THRESHOLD 1000
+#endif
+#ifndef BIG_INT_SQUARE_NTT_THRESHOLD
+#define BIG_INT_SQUARE_NTT_THRESHOLD 4000
+#endif
+
+// division:
+#ifndef BIG_INT_DIVISION_RECURSIVE_THRESHOLD
+#define BIG_INT_DIVISION_RECURSIVE_THRESHOLD 80
+#endif
+
+// conversion from and to decimal strings (see algorithms/radix.hpp):
+#ifndef BIG_INT_FROM_STRING_THRESHOLD
+#define BIG_INT_FROM_STRING_THRESHOLD 100
+#endif
+#ifndef BIG_INT_TO_STRING_THRESHOLD
+#define BIG_INT_TO_STRING_THRESHOLD 40
+#endif
+
+// multiplication using several threads (see algorithms/parallel.hpp):
+#ifndef BIG_INT_PARALLEL_THRESHOLD
+#define BIG_INT_PARALLEL_THRESHOLD 2000
+#endif
+
+const size_t KARATSUBA_THRESHOLD = BIG_INT_KARATSUBA_THRESHOLD;
+const size_t TOOM3_THRESHOLD = BIG_INT_TOOM3_THRESHOLD;
+const size_t TOOM4_THRESHOLD = BIG_INT_TOOM4_THRESHOLD;
+const size_t NTT_THRESHOLD = BIG_INT_NTT_THRESHOLD;
+
+const size_t SQUARE_KARATSUBA_THRESHOLD = BIG_INT_SQUARE_KARATSUBA_THRESHOLD;
+const size_t SQUARE_TOOM3_THRESHOLD = BIG_INT_SQUARE_TOOM3_THRESHOLD;
+const size_t SQUARE_TOOM4_THRESHOLD = BIG_INT_SQUARE_TOOM4_THRESHOLD;
+const size_t SQUARE_NTT_THRESHOLD = BIG_INT_SQUARE_NTT_THRESHOLD;
+
+const size_t DIVISION_RECURSIVE_THRESHOLD = BIG_INT_DIVISION_RECURSIVE_THRESHOLD;
+
+const size_t FROM_STRING_THRESHOLD = BIG_INT_FROM_STRING_THRESHOLD;
+const size_t TO_STRING_THRESHOLD = BIG_INT_TO_STRING_THRESHOLD;
+
+const size_t PARALLEL_THRESHOLD = BIG_INT_PARALLEL_THRESHOLD;
+
+// Karatsuba's algorithm splits operands in two, so a single limb would never
+// stop being split, and recursive division ends with Algorithm D on half of
+// the divisor, which needs at least 2 limbs
+static_assert(KARATSUBA_THRESHOLD >= 2 and SQUARE_KARATSUBA_THRESHOLD >= 2,
+              "Karatsuba thresholds should be at least 2 limbs");
+static_assert(DIVISION_RECURSIVE_THRESHOLD >= 4,
+              "the recursive division threshold should be at least 4 limbs");
+static_assert(FROM_STRING_THRESHOLD >= 1 and TO_STRING_THRESHOLD >= 1,
+              "the conversion thresholds should be at least 1 limb");
+
+#endif  // BIG_INT_THRESHOLDS_HPP
@@ -0,0 +1,55 @@
+/*
+    ===========================================================================
+    Words of limbs
+    ===========================================================================
+    Where the compiler has a 128-bit integer type (GCC and Clang on 64-bit
+    targets) and the target is little-endian, two consecutive limbs are laid
+    out exactly like one 64-bit word. The kernels for addition, subtraction,
+    multiplication and comparison then work on whole words for most of their
+    operands, so that a single 64 x 64 -> 128-bit multiplication stands in for
+    four 32 x 32 -> 64-bit ones, and a carry crosses two limbs at a time. The
+    odd limbs that are left over, and every limb on other targets (or when
+    BIG_INT_NO_WIDE_KERNELS is defined), are processed one at a time.
+*/
+
+#ifndef BIG_INT_WORDS_HPP
+#define BIG_INT_WORDS_HPP
+
+#include "LimbResource.hpp"
+
+#if !defined(BIG_INT_NO_WIDE_KERNELS) and defined(__SIZEOF_INT128__) \
+    and defined(__BYTE_ORDER__) and __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define BIG_INT_WIDE_KERNELS
+
+#include <cstring>
+
+typedef unsigned long long Word;
+__extension__ typedef unsigned __int128 DoubleWord;
+const int WORD_BITS = 64;
+
+
+/*
+    load_word
+    ---------
+    Returns the word made up of the two limbs from `limbs`.
+*/
+
+Word load_word(const Limb* limbs) {
+    Word word;
+    std::memcpy(&word, limbs, sizeof(Word));
+    return word;
+}
+
+
+/*
+    store_word
+    ----------
+    Stores `word` in the two limbs from `limbs`.
+*/
+
+void store_word(Limb* limbs, Word word) {
+    std::memcpy(limbs, &word, sizeof(Word));
+}
+#endif  // BIG_INT_WIDE_KERNELS
+
+#endif  // BIG_INT_WORDS_HPP
@@ -7,7 +7,12 @@
 #ifndef BIG_INT_CONSTRUCTORS_HPP
 #define BIG_INT_CONSTRUCTORS_HPP
 
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 #include "BigInt.hpp"
+#include "algorithms/radix.hpp"
 #include "functions/utility.hpp"
 
 
@@ -17,7 +22,6 @@
 */
 
 BigInt::BigInt() {
-    value = "0";
     sign = '+';
 }
 
@@ -28,8 +32,21 @@ BigInt::BigInt() {
 */
 
 BigInt::BigInt(const BigInt& num) {
-    value = num.value;
+    limbs = num.limbs;
+    sign = num.sign;
+}
+
+
+/*
+    Move constructor
+    ----------------
+    Takes over the limbs of `num`, which is left equal to zero.
+*/
+
+BigInt::BigInt(BigInt&& num) noexcept : limbs(std::move(num.limbs)) {
     sign = num.sign;
+    num.limbs.clear();
+    num.sign = '+';
 }
 
 
@@ -39,7 +56,8 @@ BigInt::BigInt(const BigInt& num) {
 */
 
 BigInt::BigInt(const long long& num) {
-    value = std::to_string(std::abs(num));
+    Limb magnitude[2];
+    limbs.assign(magnitude, magnitude + magnitude_to_limbs(num, magnitude));
     if (num < 0)
         sign = '-';
     else
@@ -53,26 +71,36 @@ BigInt::BigInt(const long long& num) {
 */
 
 BigInt::BigInt(const std::string& num) {
-    if (num[0] == '+' or num[0] == '-') {     // check for sign
-        std::string magnitude = num.substr(1);
-        if (is_valid_number(magnitude)) {
-            value = magnitude;
-            sign = num[0];
-        }
-        else {
-            throw std::invalid_argument("Expected an integer, got \'" + num + "\'");
-        }
+    assign_string(num, 10);
+}
+
+
+/*
+    assign_string
+    -------------
+    Sets the BigInt to the integer written in `num` in `base`, as its digits
+    after an optional sign, and after an optional prefix of 0x in base 16 or
+    0b in base 2 (neither of which can be mistaken for digits).
+*/
+
+void BigInt::assign_string(const std::string& num, int base) {
+    size_t start = (num[0] == '+' or num[0] == '-') ? 1 : 0;
+    if (num.size() > start + 2 and num[start] == '0') {
+        char prefix = num[start + 1];
+        if ((base == 16 and (prefix == 'x' or prefix == 'X'))
+                or (base == 2 and (prefix == 'b' or prefix == 'B')))
+            start += 2;
     }
-    else {      // if no sign is specified
-        if (is_valid_number(num)) {
-            value = num;
-            sign = '+';    // positive by default
-        }
-        else {
+    if (!is_valid_number(num.data() + start, num.size() - start, base)) {
+        if (base == 10)
             throw std::invalid_argument("Expected an integer, got \'" + num + "\'");
-        }
+        throw std::invalid_argument("Expected an integer in base "
+                + std::to_string(base) + ", got \'" + num + "\'");
     }
-    strip_leading_zeroes(value);
+
+    digits_to_limbs(limbs, num.data() + start, num.size() - start, base);
+    // zero is never negative
+    sign = (num[0] == '-' and !limbs.empty()) ? '-' : '+';
 }
 
 #endif  // BIG_INT_CONSTRUCTORS_HPP
@@ -7,16 +7,67 @@
 #ifndef BIG_INT_CONVERSION_FUNCTIONS_HPP
 #define BIG_INT_CONVERSION_FUNCTIONS_HPP
 
+#include <climits>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "BigInt.hpp"
+#include "algorithms/radix.hpp"
+#include "functions/utility.hpp"
+
+
+/*
+    check_base
+    ----------
+    Throws an invalid_argument exception if `base` is not from 2 to 36.
+*/
+
+void check_base(int base) {
+    if (base < 2 or base > MAX_BASE)
+        throw std::invalid_argument("Expected a base from 2 to "
+                + std::to_string(MAX_BASE) + ", got " + std::to_string(base));
+}
+
 
 /*
     to_string
     ---------
-    Converts a BigInt to a string.
+    Converts a BigInt to a string of its digits in `base` (from 2 to 36, and
+    10 by default), using lowercase letters for the digits from 10 on.
 */
 
-std::string BigInt::to_string() const {
+std::string BigInt::to_string(int base) const {
+    check_base(base);
+    if (limbs.empty())
+        return "0";
+
     // prefix with sign if negative
-    return this->sign == '-' ? "-" + this->value : this->value;
+    std::string digits(sign == '-' ? "-" : "");
+    digits.reserve((size_t) (limbs.size() * LIMB_BITS * std::log(2.0)
+                             / std::log((double) base)) + 2);
+    limbs_to_digits(digits, limbs.data(), limbs.size(), 0, base);
+
+    return digits;
+}
+
+
+/*
+    from_string
+    -----------
+    Converts a string of digits in `base` (from 2 to 36) to a BigInt. The
+    digits may be preceded by a sign, and in base 16 or 2 by a prefix of 0x or
+    0b, and the letters for the digits from 10 on may be in either case.
+    NOTE: If the string is not an integer in the base, an invalid_argument
+    exception is thrown.
+*/
+
+BigInt from_string(const std::string& num, int base) {
+    check_base(base);
+    BigInt result;
+    result.assign_string(num, base);
+
+    return result;
 }
 
 
@@ -24,12 +75,16 @@ std::string BigInt::to_string() const {
     to_int
     ------
     Converts a BigInt to an int.
-    NOTE: If the BigInt is out of range of an int, stoi() will throw an
-    out_of_range exception.
+    NOTE: If the BigInt is out of range of an int, an out_of_range exception is
+    thrown.
 */
 
 int BigInt::to_int() const {
-    return std::stoi(this->to_string());
+    long long num = this->to_long_long();
+    if (num < INT_MIN or num > INT_MAX)
+        throw std::out_of_range("BigInt is out of range of an int");
+
+    return (int) num;
 }
 
 
@@ -37,12 +92,16 @@ int BigInt::to_int() const {
     to_long
     -------
     Converts a BigInt to a long int.
-    NOTE: If the BigInt is out of range of a long int, stol() will throw an
-    out_of_range exception.
+    NOTE: If the BigInt is out of range of a long int, an out_of_range
+    exception is thrown.
 */
 
 long BigInt::to_long() const {
-    return std::stol(this->to_string());
+    long long num = this->to_long_long();
+    if (num < LONG_MIN or num > LONG_MAX)
+        throw std::out_of_range("BigInt is out of range of a long int");
+
+    return (long) num;
 }
 
 
@@ -50,12 +109,29 @@ long BigInt::to_long() const {
     to_long_long
     ------------
     Converts a BigInt to a long long int.
-    NOTE: If the BigInt is out of range of a long long int, stoll() will throw
-    an out_of_range exception.
+    NOTE: If the BigInt is out of range of a long long int, an out_of_range
+    exception is thrown.
 */
 
 long long BigInt::to_long_long() const {
-    return std::stoll(this->to_string());
+    unsigned long long magnitude = 0;
+    if (limbs.size() * LIMB_BITS <= sizeof(magnitude) * CHAR_BIT)
+        for (size_t i = limbs.size(); i-- > 0; )
+            magnitude = (magnitude << LIMB_BITS) | limbs[i];
+    else
+        magnitude = ULLONG_MAX;     // certainly out of range
+
+    if (this->sign == '+') {
+        if (magnitude > LLONG_MAX)
+            throw std::out_of_range("BigInt is out of range of a long long int");
+        return (long long) magnitude;
+    }
+    if (magnitude > (unsigned long long) LLONG_MAX + 1)
+        throw std::out_of_range("BigInt is out of range of a long long int");
+    if (magnitude == (unsigned long long) LLONG_MAX + 1)
+        return LLONG_MIN;
+
+    return -(long long) magnitude;
 }
 
 #endif  // BIG_INT_CONVERSION_FUNCTIONS_HPP
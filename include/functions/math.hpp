@@ -8,8 +8,14 @@
 #define BIG_INT_MATH_FUNCTIONS_HPP
 
 #include <string>
+#include <tuple>
+#include <utility>
 
+#include "BigInt.hpp"
+#include "algorithms/multiplication.hpp"
 #include "functions/conversion.hpp"
+#include "functions/utility.hpp"
+#include "operators/relational.hpp"
 
 
 /*
@@ -24,14 +30,96 @@ BigInt abs(const BigInt& num) {
 
 
 /*
-    big_pow10
-    ---------
-    Returns a BigInt equal to 10^exp.
-    NOTE: exponent should be a non-negative integer.
+    square
+    ------
+    Returns a BigInt equal to num^2, computed faster than `num * num` would be
+    by a general multiplication.
 */
 
-BigInt big_pow10(size_t exp) {
-    return BigInt("1" + std::string(exp, '0'));
+BigInt square(const BigInt& num) {
+    BigInt result;
+    square_limbs(result.limbs, num.limbs.data(), num.limbs.size());
+
+    return result;
+}
+
+
+/*
+    addmul
+    ------
+    Adds the product of `num1` and `num2` to `acc`, accumulating it directly
+    in the limbs of `acc` rather than in a temporary BigInt.
+*/
+
+void addmul(BigInt& acc, const BigInt& num1, const BigInt& num2) {
+    // the product of operands that are `acc` itself is taken from a copy
+    if (&acc == &num1 or &acc == &num2) {
+        BigInt copy = acc;
+        addmul(acc, &num1 == &acc ? copy : num1, &num2 == &acc ? copy : num2);
+        return;
+    }
+
+    acc.accumulate_product(num1.limbs.data(), num1.limbs.size(),
+                           num2.limbs.data(), num2.limbs.size(),
+                           num1.sign != num2.sign);
+}
+
+
+/*
+    addmul (Integer)
+    ----------------
+*/
+
+void addmul(BigInt& acc, const BigInt& num1, const long long& num2) {
+    if (&acc == &num1) {
+        BigInt copy = acc;
+        addmul(acc, copy, num2);
+        return;
+    }
+
+    Limb num2_limbs[2];
+    size_t size2 = magnitude_to_limbs(num2, num2_limbs);
+    acc.accumulate_product(num1.limbs.data(), num1.limbs.size(), num2_limbs,
+                           size2, (num1.sign == '-') != (num2 < 0));
+}
+
+
+/*
+    submul
+    ------
+    Subtracts the product of `num1` and `num2` from `acc`, accumulating it
+    directly in the limbs of `acc` rather than in a temporary BigInt.
+*/
+
+void submul(BigInt& acc, const BigInt& num1, const BigInt& num2) {
+    if (&acc == &num1 or &acc == &num2) {
+        BigInt copy = acc;
+        submul(acc, &num1 == &acc ? copy : num1, &num2 == &acc ? copy : num2);
+        return;
+    }
+
+    acc.accumulate_product(num1.limbs.data(), num1.limbs.size(),
+                           num2.limbs.data(), num2.limbs.size(),
+                           num1.sign == num2.sign);
+}
+
+
+/*
+    submul (Integer)
+    ----------------
+*/
+
+void submul(BigInt& acc, const BigInt& num1, const long long& num2) {
+    if (&acc == &num1) {
+        BigInt copy = acc;
+        submul(acc, copy, num2);
+        return;
+    }
+
+    Limb num2_limbs[2];
+    size_t size2 = magnitude_to_limbs(num2, num2_limbs);
+    acc.accumulate_product(num1.limbs.data(), num1.limbs.size(), num2_limbs,
+                           size2, (num1.sign == '-') == (num2 < 0));
 }
 
 
@@ -45,7 +133,7 @@ BigInt pow(const BigInt& base, int exp) {
     if (exp < 0) {
         if (base == 0)
             throw std::logic_error("Cannot divide by zero");
-        return abs(base) == 1 ? base : 0;
+        return compare_abs(base, 1) == 0 ? base : 0;
     }
     if (exp == 0) {
         if (base == 0)
@@ -57,7 +145,7 @@ BigInt pow(const BigInt& base, int exp) {
     while (exp > 1) {
         if (exp % 2)
             result_odd *= result;
-        result *= result;
+        result = square(result);
         exp /= 2;
     }
 
@@ -65,6 +153,18 @@ BigInt pow(const BigInt& base, int exp) {
 }
 
 
+/*
+    big_pow10
+    ---------
+    Returns a BigInt equal to 10^exp.
+    NOTE: exponent should be a non-negative integer.
+*/
+
+BigInt big_pow10(size_t exp) {
+    return pow(BigInt(10), (int) exp);
+}
+
+
 /*
     pow (Integer)
     -------------
@@ -109,17 +209,21 @@ BigInt sqrt(const BigInt& num) {
     else if (num < 16)
         return 3;
 
-    BigInt sqrt_prev = -1;
-    // The value for `sqrt_current` is chosen close to that of the actual
-    // square root.
-    // Since a number's square root has at least one less than half as many
-    // digits as the number,
-    //     sqrt_current = 10^(half_the_digits_in_num - 1)
-    BigInt sqrt_current = big_pow10(num.to_string().size() / 2 - 1);
-
-    while (abs(sqrt_current - sqrt_prev) > 1) {
-        sqrt_prev = sqrt_current;
-        sqrt_current = (num / sqrt_prev + sqrt_prev) / 2;
+    // The value for `sqrt_current` is chosen to be no less than the actual
+    // square root, so that Newton's iterations decrease monotonically towards
+    // it. Since a number with `n` bits is less than 2^n,
+    //     sqrt_current = 2^ceil(n / 2)
+    size_t half_the_bits = (count_bits(num.limbs) + 1) / 2;
+    BigInt sqrt_current;
+    sqrt_current.limbs.assign(half_the_bits / LIMB_BITS + 1, 0);
+    sqrt_current.limbs.back() = (Limb) 1 << (half_the_bits % LIMB_BITS);
+
+    // each step allocates only for the quotient, which then takes the sum
+    // and its halving in place
+    BigInt sqrt_next = (num / sqrt_current + sqrt_current) / 2;
+    while (sqrt_next < sqrt_current) {
+        sqrt_current = std::move(sqrt_next);
+        sqrt_next = (num / sqrt_current + sqrt_current) / 2;
     }
 
     return sqrt_current;
@@ -143,11 +247,11 @@ BigInt gcd(const BigInt &num1, const BigInt &num2){
     if (abs_num1 == 0)
         return abs_num2;    // gcd(0, a) = |a|
 
-    BigInt remainder = abs_num2;
-    while (remainder != 0) {
-        remainder = abs_num1 % abs_num2;
-        abs_num1 = abs_num2;    // previous remainder
-        abs_num2 = remainder;   // current remainder
+    BigInt quotient, remainder;
+    while (abs_num2 != 0) {
+        std::tie(quotient, remainder) = divmod(abs_num1, abs_num2);
+        abs_num1 = std::move(abs_num2);     // previous remainder
+        abs_num2 = std::move(remainder);    // current remainder
     }
 
     return abs_num1;
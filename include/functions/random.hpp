@@ -11,6 +11,7 @@
 #include <climits>
 
 #include "BigInt.hpp"
+#include "constructors/constructors.hpp"
 
 // when the number of digits are not specified, a random value is used for it
 // which is kept below the following:
@@ -30,18 +31,15 @@ BigInt big_random(size_t num_digits = 0) {
         // use a random number for it:
         num_digits = 1 + rand_generator() % MAX_RANDOM_LENGTH;
 
-    BigInt big_rand;
-    big_rand.value = "";    // clear value to append digits
-
     // ensure that the first digit is non-zero
-    big_rand.value += std::to_string(1 + rand_generator() % 9);
+    std::string digits = std::to_string(1 + rand_generator() % 9);
 
-    while (big_rand.value.size() < num_digits)
-        big_rand.value += std::to_string(rand_generator());
-    if (big_rand.value.size() != num_digits)
-        big_rand.value.erase(num_digits);   // erase extra digits
+    while (digits.size() < num_digits)
+        digits += std::to_string(rand_generator());
+    if (digits.size() != num_digits)
+        digits.erase(num_digits);   // erase extra digits
 
-    return big_rand;
+    return BigInt(digits);
 }
 
 
@@ -0,0 +1,267 @@
+/*
+    ===========================================================================
+    Serialization functions for BigInt
+    ===========================================================================
+    A serialized BigInt is a header of SERIALIZATION_HEADER_SIZE bytes:
+
+        bytes 0-3:      the magic "BINT"
+        byte 4:         the version of the format, SERIALIZATION_VERSION
+        byte 5:         the sign, 1 if the BigInt is negative and 0 otherwise
+        bytes 6-7:      zero (reserved)
+        bytes 8-15:     the number of limbs, as a little-endian 64-bit integer
+
+    followed by the limbs, least significant first, each as 4 little-endian
+    bytes. Zero has no limbs and no sign, and the most significant limb of any
+    other BigInt is not zero, so every BigInt has exactly one serialization.
+    Serializations are multiples of 4 bytes long, so the limbs of ones that
+    are stored back to back from an aligned address (such as the start of a
+    memory-mapped file) are all aligned.
+*/
+
+#ifndef BIG_INT_SERIALIZATION_FUNCTIONS_HPP
+#define BIG_INT_SERIALIZATION_FUNCTIONS_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "BigInt.hpp"
+
+const uint8_t SERIALIZATION_MAGIC[4] = {'B', 'I', 'N', 'T'};
+const uint8_t SERIALIZATION_VERSION = 1;
+const size_t SERIALIZATION_HEADER_SIZE = 16;
+
+// Whether limbs are stored in the same byte order on this machine as in a
+// serialization, so that they can be copied (or read) in place:
+#if defined(__BYTE_ORDER__) and __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ \
+        or defined(_M_IX86) or defined(_M_X64) or defined(_M_ARM64)
+const bool LITTLE_ENDIAN_LIMBS = true;
+#else
+const bool LITTLE_ENDIAN_LIMBS = false;
+#endif
+
+
+/*
+    store_little_endian
+    -------------------
+    Stores the lowest `count` bytes of `value` in `bytes`, least significant
+    first.
+*/
+
+void store_little_endian(uint8_t* bytes, uint64_t value, size_t count) {
+    for (size_t i = 0; i < count; i++)
+        bytes[i] = (uint8_t) (value >> (8 * i));
+}
+
+
+/*
+    load_little_endian
+    ------------------
+    Returns the integer stored in `count` bytes, least significant first.
+*/
+
+uint64_t load_little_endian(const uint8_t* bytes, size_t count) {
+    uint64_t value = 0;
+    for (size_t i = count; i-- > 0; )
+        value = (value << 8) | bytes[i];
+
+    return value;
+}
+
+
+/*
+    BigIntView
+    ----------
+    A read-only view of a serialized BigInt, which reads its limbs from the
+    serialization without copying them. The serialization must outlive the
+    view.
+*/
+
+class BigIntView {
+    const uint8_t* view_limbs;      // the serialized limbs
+    size_t view_size;
+    char view_sign;
+
+    public:
+        // Constructor:
+        BigIntView(const uint8_t*, size_t);
+
+        // Accessors:
+        char sign() const { return view_sign; }
+        size_t size() const { return view_size; }
+        Limb limb(size_t) const;
+        const Limb* limbs() const;
+        size_t serialized_size() const;
+
+        // Conversion:
+        BigInt to_big_int() const;
+};
+
+
+/*
+    BigIntView constructor
+    ----------------------
+    Views the serialized BigInt at the start of the `size` bytes of `data`.
+    NOTE: If the bytes do not start with a serialized BigInt, an
+    invalid_argument exception is thrown.
+*/
+
+BigIntView::BigIntView(const uint8_t* data, size_t size) {
+    if (size < SERIALIZATION_HEADER_SIZE
+            or std::memcmp(data, SERIALIZATION_MAGIC, 4) != 0)
+        throw std::invalid_argument("Expected a serialized BigInt");
+    if (data[4] != SERIALIZATION_VERSION)
+        throw std::invalid_argument("Expected a serialized BigInt of version "
+                + std::to_string(SERIALIZATION_VERSION) + ", got version "
+                + std::to_string(data[4]));
+    if (data[5] > 1 or data[6] != 0 or data[7] != 0)
+        throw std::invalid_argument("Expected a serialized BigInt, got a "
+                "malformed header");
+
+    uint64_t num_limbs = load_little_endian(data + 8, 8);
+    if (num_limbs > (size - SERIALIZATION_HEADER_SIZE) / sizeof(Limb))
+        throw std::invalid_argument("Expected a serialized BigInt of "
+                + std::to_string(num_limbs) + " limbs, got "
+                + std::to_string(size) + " bytes");
+
+    view_limbs = data + SERIALIZATION_HEADER_SIZE;
+    view_size = (size_t) num_limbs;
+    view_sign = data[5] ? '-' : '+';
+    if (view_size == 0 ? view_sign == '-' : limb(view_size - 1) == 0)
+        throw std::invalid_argument("Expected a serialized BigInt, got "
+                "leading zeroes or a negative zero");
+}
+
+
+/*
+    BigIntView::limb
+    ----------------
+    Returns the limb at index `i`, with the least significant limb at 0.
+*/
+
+Limb BigIntView::limb(size_t i) const {
+    if (LITTLE_ENDIAN_LIMBS) {
+        Limb value;
+        std::memcpy(&value, view_limbs + i * sizeof(Limb), sizeof(Limb));
+        return value;
+    }
+
+    return (Limb) load_little_endian(view_limbs + i * sizeof(Limb),
+                                     sizeof(Limb));
+}
+
+
+/*
+    BigIntView::limbs
+    -----------------
+    Returns a pointer to the limbs in the serialization, if they can be read
+    in place (that is, if this machine is little-endian and they are aligned),
+    or else a null pointer.
+*/
+
+const Limb* BigIntView::limbs() const {
+    if (LITTLE_ENDIAN_LIMBS
+            and (uintptr_t) view_limbs % alignof(Limb) == 0)
+        return reinterpret_cast<const Limb*>(view_limbs);
+
+    return nullptr;
+}
+
+
+/*
+    BigIntView::serialized_size
+    ---------------------------
+    Returns the number of bytes in the serialization, so that the one stored
+    after it begins at that offset.
+*/
+
+size_t BigIntView::serialized_size() const {
+    return SERIALIZATION_HEADER_SIZE + view_size * sizeof(Limb);
+}
+
+
+/*
+    BigIntView::to_big_int
+    ----------------------
+    Returns a BigInt with a copy of the viewed value.
+*/
+
+BigInt BigIntView::to_big_int() const {
+    BigInt result;
+    if (const Limb* in_place = limbs())
+        result.limbs.assign(in_place, in_place + view_size);
+    else {
+        result.limbs.resize(view_size);
+        if (LITTLE_ENDIAN_LIMBS)
+            std::memcpy(result.limbs.data(), view_limbs,
+                        view_size * sizeof(Limb));
+        else
+            for (size_t i = 0; i < view_size; i++)
+                result.limbs[i] = limb(i);
+    }
+    result.sign = view_sign;
+
+    return result;
+}
+
+
+/*
+    serialized_size
+    ---------------
+    Returns the number of bytes in the serialization of a BigInt.
+*/
+
+size_t serialized_size(const BigInt& num) {
+    return SERIALIZATION_HEADER_SIZE + num.limbs.size() * sizeof(Limb);
+}
+
+
+/*
+    serialize
+    ---------
+    Writes the serialization of a BigInt to the start of a buffer of `size`
+    bytes, and returns the number of bytes written.
+    NOTE: If the buffer is shorter than the serialization, an invalid_argument
+    exception is thrown.
+*/
+
+size_t serialize(const BigInt& num, uint8_t* buffer, size_t size) {
+    size_t num_bytes = serialized_size(num);
+    if (size < num_bytes)
+        throw std::invalid_argument("Expected a buffer of at least "
+                + std::to_string(num_bytes) + " bytes, got "
+                + std::to_string(size));
+
+    std::memcpy(buffer, SERIALIZATION_MAGIC, 4);
+    buffer[4] = SERIALIZATION_VERSION;
+    buffer[5] = num.sign == '-' and !num.limbs.empty();
+    buffer[6] = buffer[7] = 0;
+    store_little_endian(buffer + 8, num.limbs.size(), 8);
+
+    uint8_t* limb_bytes = buffer + SERIALIZATION_HEADER_SIZE;
+    if (LITTLE_ENDIAN_LIMBS)
+        std::memcpy(limb_bytes, num.limbs.data(),
+                    num.limbs.size() * sizeof(Limb));
+    else
+        for (size_t i = 0; i < num.limbs.size(); i++)
+            store_little_endian(limb_bytes + i * sizeof(Limb), num.limbs[i],
+                                sizeof(Limb));
+
+    return num_bytes;
+}
+
+
+/*
+    deserialize
+    -----------
+    Returns the BigInt serialized at the start of the `size` bytes of `data`.
+    NOTE: If the bytes do not start with a serialized BigInt, an
+    invalid_argument exception is thrown.
+*/
+
+BigInt deserialize(const uint8_t* data, size_t size) {
+    return BigIntView(data, size).to_big_int();
+}
+
+#endif  // BIG_INT_SERIALIZATION_FUNCTIONS_HPP
@@ -7,107 +7,244 @@
 #ifndef BIG_INT_UTILITY_FUNCTIONS_HPP
 #define BIG_INT_UTILITY_FUNCTIONS_HPP
 
-#include <tuple>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "BigInt.hpp"
+#include "algorithms/words.hpp"
+
+// Decimal text is converted to and from limbs in chunks of 9 digits, the
+// largest power of 10 that fits in a limb.
+const Limb DECIMAL_CHUNK = 1000000000;
+const size_t DIGITS_PER_CHUNK = 9;
+
+// Strings can be in any base from 2 up to this one, with the letters standing
+// for the digits from 10 on.
+const int MAX_BASE = 36;
+
+// The values of all characters as digits in any base up to MAX_BASE, which is
+// the value of those that are not digits in any of them.
+const unsigned char DIGIT_VALUES[256] = {
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 36, 36, 36, 36, 36, 36,
+    36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36
+};
 
 
 /*
     is_valid_number
     ---------------
-    Checks whether the given string is a valid integer.
+    Checks whether the given string is a valid integer, i.e. whether it is made
+    up of decimal digits only. Eight characters at a time are checked as one
+    64-bit word, in which every byte of a digit has a high nibble of 3 and a
+    low nibble that does not carry into the high nibble when 6 is added to it.
 */
 
-bool is_valid_number(const std::string& num) {
-    for (char digit : num)
-        if (digit < '0' or digit > '9')
+bool is_valid_number(const char* num, size_t length) {
+    const uint64_t HIGH_NIBBLES = 0xF0F0F0F0F0F0F0F0ULL;
+    const uint64_t SIXES = 0x0606060606060606ULL;
+    const uint64_t THREES = 0x3333333333333333ULL;
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t chars;
+        std::memcpy(&chars, num + i, sizeof(chars));
+        // a carry out of an invalid byte may corrupt the byte above it, but
+        // the word is rejected anyway because of the invalid byte itself
+        if (((chars & HIGH_NIBBLES) | (((chars + SIXES) & HIGH_NIBBLES) >> 4))
+                != THREES)
+            return false;
+    }
+    for (; i < length; i++)
+        if (num[i] < '0' or num[i] > '9')
             return false;
 
     return true;
 }
 
+bool is_valid_number(const std::string& num) {
+    return is_valid_number(num.data(), num.size());
+}
+
 
 /*
-    strip_leading_zeroes
-    --------------------
-    Strip the leading zeroes from a number represented as a string.
+    digit_value
+    -----------
+    Returns the value of a digit in any base up to 36, where the letters (in
+    either case) stand for the digits from 10 to 35, or MAX_BASE if the
+    character is not a digit. The values are looked up in a table, since
+    branching on the ranges of characters is slow for random digits.
 */
 
-void strip_leading_zeroes(std::string& num) {
-    size_t i;
-    for (i = 0; i < num.size(); i++)
-        if (num[i] != '0')
-            break;
+int digit_value(char digit) {
+    return DIGIT_VALUES[(unsigned char) digit];
+}
+
+
+/*
+    is_valid_number (base)
+    ----------------------
+    Checks whether the given string is a valid integer in `base`, i.e. whether
+    it is made up of digits in that base only.
+*/
 
-    if (i == num.size())
-        num = "0";
-    else
-        num = num.substr(i);
+bool is_valid_number(const char* num, size_t length, int base) {
+    if (base == 10)
+        return is_valid_number(num, length);
+
+    for (size_t i = 0; i < length; i++)
+        if (digit_value(num[i]) >= base)
+            return false;
+
+    return true;
 }
 
 
 /*
-    add_leading_zeroes
-    ------------------
-    Adds a given number of leading zeroes to a string-represented integer `num`.
+    strip_leading_zero_limbs
+    ------------------------
+    Strips the most significant zero limbs from a magnitude, so that zero is
+    represented by no limbs at all.
 */
 
-void add_leading_zeroes(std::string& num, size_t num_zeroes) {
-    num = std::string(num_zeroes, '0') + num;
+void strip_leading_zero_limbs(LimbVector& num) {
+    while (!num.empty() and num.back() == 0)
+        num.pop_back();
 }
 
 
 /*
-    add_trailing_zeroes
-    -------------------
-    Adds a given number of trailing zeroes to a string-represented integer `num`.
+    magnitude_to_limbs
+    ------------------
+    Stores the magnitude of an integer in `limbs`, which must have room for 2
+    of them, and returns the number of limbs it takes (none for zero).
 */
 
-void add_trailing_zeroes(std::string& num, size_t num_zeroes) {
-    num += std::string(num_zeroes, '0');
+size_t magnitude_to_limbs(const long long& num, Limb* limbs) {
+    // negate in unsigned arithmetic, which is well-defined even for LLONG_MIN
+    unsigned long long magnitude = num < 0 ? 0ULL - num : num;
+    size_t size = 0;
+    for (; magnitude; magnitude >>= LIMB_BITS)
+        limbs[size++] = (Limb) magnitude;
+
+    return size;
 }
 
 
 /*
-    get_larger_and_smaller
-    ----------------------
-    Identifies the given string-represented integers as `larger` and `smaller`,
-    padding the smaller number with leading zeroes to make it equal in length to
-    the larger number.
+    compare_limbs
+    -------------
+    Compares two magnitudes, `num1` (of `size1` limbs) and `num2` (of `size2`
+    limbs), neither with leading zero limbs, returning -1, 0 or 1 if `num1` is
+    less than, equal to or greater than `num2` respectively.
 */
 
-std::tuple<std::string, std::string> get_larger_and_smaller(const std::string& num1,
-        const std::string& num2) {
-    std::string larger, smaller;
-    if (num1.size() > num2.size() or
-        (num1.size() == num2.size() and num1 > num2)) {
-        larger = num1;
-        smaller = num2;
+int compare_limbs(const Limb* num1, size_t size1, const Limb* num2, size_t size2) {
+    if (size1 != size2)
+        return size1 < size2 ? -1 : 1;
+
+    size_t i = size1;
+#ifdef BIG_INT_WIDE_KERNELS
+    for (; i >= 2; i -= 2) {
+        Word word1 = load_word(num1 + i - 2), word2 = load_word(num2 + i - 2);
+        if (word1 != word2)
+            return word1 < word2 ? -1 : 1;
     }
-    else {
-        larger = num2;
-        smaller = num1;
+#endif
+    for (; i-- > 0; )
+        if (num1[i] != num2[i])
+            return num1[i] < num2[i] ? -1 : 1;
+
+    return 0;
+}
+
+int compare_limbs(const LimbVector& num1, const LimbVector& num2) {
+    return compare_limbs(num1.data(), num1.size(), num2.data(), num2.size());
+}
+
+
+/*
+    count_bits
+    ----------
+    Returns the number of significant bits in a magnitude.
+*/
+
+size_t count_bits(const LimbVector& num) {
+    if (num.empty())
+        return 0;
+
+    size_t num_bits = (num.size() - 1) * LIMB_BITS;
+    for (Limb top = num.back(); top != 0; top >>= 1)
+        num_bits++;
+
+    return num_bits;
+}
+
+
+/*
+    multiply_and_add_limb
+    ---------------------
+    Replaces a magnitude `num` with `num * multiplier + addend`.
+*/
+
+void multiply_and_add_limb(LimbVector& num, Limb multiplier, Limb addend) {
+    DoubleLimb carry = addend;
+    for (Limb& limb : num) {
+        carry += (DoubleLimb) limb * multiplier;
+        limb = (Limb) carry;
+        carry >>= LIMB_BITS;
     }
+    if (carry)
+        num.push_back((Limb) carry);
+}
 
-    // pad the smaller number with zeroes
-    add_leading_zeroes(smaller, larger.size() - smaller.size());
 
-    return std::make_tuple(larger, smaller);
+/*
+    divide_by_limb
+    --------------
+    Divides a magnitude `num` by a non-zero `divisor` in place, and returns the
+    remainder. The quotient may be left with leading zero limbs.
+*/
+
+Limb divide_by_limb(LimbVector& num, Limb divisor) {
+    DoubleLimb remainder = 0;
+    for (size_t i = num.size(); i-- > 0; ) {
+        remainder = (remainder << LIMB_BITS) | num[i];
+        num[i] = (Limb) (remainder / divisor);
+        remainder %= divisor;
+    }
+
+    return (Limb) remainder;
 }
 
 
 /*
-    is_power_of_10
-    ----------------------
-    Checks whether a string-represented integer is a power of 10.
+    modulo_by_limb
+    --------------
+    Returns the remainder on dividing a magnitude `num` by a non-zero
+    `divisor`, without computing the quotient.
 */
 
-bool is_power_of_10(const std::string& num){
-    if (num[0] != '1')
-        return false;
-    for (size_t i = 1; i < num.size(); i++)
-        if (num[i] != '0')
-            return false;
+Limb modulo_by_limb(const LimbVector& num, Limb divisor) {
+    DoubleLimb remainder = 0;
+    for (size_t i = num.size(); i-- > 0; )
+        remainder = ((remainder << LIMB_BITS) | num[i]) % divisor;
 
-    return true;    // first digit is 1 and the following digits are all 0
+    return (Limb) remainder;
 }
 
 #endif  // BIG_INT_UTILITY_FUNCTIONS_HPP
@@ -8,6 +8,7 @@
 #define BIG_INT_ARITHMETIC_ASSIGNMENT_OPERATORS_HPP
 
 #include "BigInt.hpp"
+#include "algorithms/addition.hpp"
 #include "constructors/constructors.hpp"
 #include "operators/assignment.hpp"
 #include "operators/binary_arithmetic.hpp"
@@ -19,7 +20,7 @@
 */
 
 BigInt& BigInt::operator+=(const BigInt& num) {
-    *this = *this + num;
+    assign_sum(*this, num, false);
 
     return *this;
 }
@@ -31,7 +32,7 @@ BigInt& BigInt::operator+=(const BigInt& num) {
 */
 
 BigInt& BigInt::operator-=(const BigInt& num) {
-    *this = *this - num;
+    assign_sum(*this, num, true);
 
     return *this;
 }
@@ -79,7 +80,7 @@ BigInt& BigInt::operator%=(const BigInt& num) {
 */
 
 BigInt& BigInt::operator+=(const long long& num) {
-    *this = *this + BigInt(num);
+    assign_sum(*this, num, false);
 
     return *this;
 }
@@ -91,7 +92,7 @@ BigInt& BigInt::operator+=(const long long& num) {
 */
 
 BigInt& BigInt::operator-=(const long long& num) {
-    *this = *this - BigInt(num);
+    assign_sum(*this, num, true);
 
     return *this;
 }
@@ -103,7 +104,7 @@ BigInt& BigInt::operator-=(const long long& num) {
 */
 
 BigInt& BigInt::operator*=(const long long& num) {
-    *this = *this * BigInt(num);
+    assign_product(*this, num);
 
     return *this;
 }
@@ -115,7 +116,7 @@ BigInt& BigInt::operator*=(const long long& num) {
 */
 
 BigInt& BigInt::operator/=(const long long& num) {
-    *this = *this / BigInt(num);
+    assign_quotient(*this, num);
 
     return *this;
 }
@@ -127,7 +128,7 @@ BigInt& BigInt::operator/=(const long long& num) {
 */
 
 BigInt& BigInt::operator%=(const long long& num) {
-    *this = *this % BigInt(num);
+    *this = *this % num;
 
     return *this;
 }
@@ -139,7 +140,7 @@ BigInt& BigInt::operator%=(const long long& num) {
 */
 
 BigInt& BigInt::operator+=(const std::string& num) {
-    *this = *this + BigInt(num);
+    assign_sum(*this, BigInt(num), false);
 
     return *this;
 }
@@ -151,7 +152,7 @@ BigInt& BigInt::operator+=(const std::string& num) {
 */
 
 BigInt& BigInt::operator-=(const std::string& num) {
-    *this = *this - BigInt(num);
+    assign_sum(*this, BigInt(num), true);
 
     return *this;
 }
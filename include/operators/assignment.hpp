@@ -7,6 +7,8 @@
 #ifndef BIG_INT_ASSIGNMENT_OPERATORS_HPP
 #define BIG_INT_ASSIGNMENT_OPERATORS_HPP
 
+#include <utility>
+
 #include "BigInt.hpp"
 #include "constructors/constructors.hpp"
 
@@ -17,22 +19,38 @@
 */
 
 BigInt& BigInt::operator=(const BigInt& num) {
-    value = num.value;
+    limbs = num.limbs;
     sign = num.sign;
 
     return *this;
 }
 
 
+/*
+    BigInt = BigInt (move)
+    ----------------------
+    Takes over the limbs of `num`, which is left equal to zero.
+*/
+
+BigInt& BigInt::operator=(BigInt&& num) noexcept {
+    if (this != &num) {
+        limbs = std::move(num.limbs);
+        sign = num.sign;
+        num.limbs.clear();
+        num.sign = '+';
+    }
+
+    return *this;
+}
+
+
 /*
     BigInt = Integer
     ----------------
 */
 
 BigInt& BigInt::operator=(const long long& num) {
-    BigInt temp(num);
-    value = temp.value;
-    sign = temp.sign;
+    *this = BigInt(num);
 
     return *this;
 }
@@ -44,11 +62,21 @@ BigInt& BigInt::operator=(const long long& num) {
 */
 
 BigInt& BigInt::operator=(const std::string& num) {
-    BigInt temp(num);
-    value = temp.value;
-    sign = temp.sign;
+    *this = BigInt(num);
 
     return *this;
 }
 
+
+/*
+    swap
+    ----
+    Exchanges the values of two BigInts without copying their limbs.
+*/
+
+void swap(BigInt& num1, BigInt& num2) noexcept {
+    num1.limbs.swap(num2.limbs);
+    std::swap(num1.sign, num2.sign);
+}
+
 #endif  // BIG_INT_ASSIGNMENT_OPERATORS_HPP
@@ -7,12 +7,18 @@
 #ifndef BIG_INT_BINARY_ARITHMETIC_OPERATORS_HPP
 #define BIG_INT_BINARY_ARITHMETIC_OPERATORS_HPP
 
-#include <climits>
-#include <cmath>
+#include <algorithm>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <utility>
 
 #include "BigInt.hpp"
+#include "algorithms/addition.hpp"
+#include "algorithms/division.hpp"
+#include "algorithms/multiplication.hpp"
 #include "constructors/constructors.hpp"
+#include "functions/conversion.hpp"
 #include "functions/math.hpp"
 #include "functions/utility.hpp"
 #include "operators/arithmetic_assignment.hpp"
@@ -31,39 +37,10 @@ const long long FLOOR_SQRT_LLONG_MAX = 3037000499;
 */
 
 BigInt BigInt::operator+(const BigInt& num) const {
-    // if the operands are of opposite signs, perform subtraction
-    if (this->sign == '+' and num.sign == '-') {
-        BigInt rhs = num;
-        rhs.sign = '+';
-        return *this - rhs;
-    }
-    else if (this->sign == '-' and num.sign == '+') {
-        BigInt lhs = *this;
-        lhs.sign = '+';
-        return -(lhs - num);
-    }
-
-    // identify the numbers as `larger` and `smaller`
-    std::string larger, smaller;
-    std::tie(larger, smaller) = get_larger_and_smaller(this->value, num.value);
-
-    BigInt result;      // the resultant sum
-    result.value = "";  // the value is cleared as the digits will be appended
-    short carry = 0, sum;
-    // add the two values
-    for (long i = larger.size() - 1; i >= 0; i--) {
-        sum = larger[i] - '0' + smaller[i] - '0' + carry;
-        result.value = std::to_string(sum % 10) + result.value;
-        carry = sum / (short) 10;
-    }
-    if (carry)
-        result.value = std::to_string(carry) + result.value;
-
-    // if the operands are negative, the result is negative
-    if (this->sign == '-' and result.value != "0")
-        result.sign = '-';
+    BigInt sum;
+    sum.assign_sum(*this, num, false);
 
-    return result;
+    return sum;
 }
 
 
@@ -74,234 +51,178 @@ BigInt BigInt::operator+(const BigInt& num) const {
 */
 
 BigInt BigInt::operator-(const BigInt& num) const {
-    // if the operands are of opposite signs, perform addition
-    if (this->sign == '+' and num.sign == '-') {
-        BigInt rhs = num;
-        rhs.sign = '+';
-        return *this + rhs;
-    }
-    else if (this->sign == '-' and num.sign == '+') {
-        BigInt lhs = *this;
-        lhs.sign = '+';
-        return -(lhs + num);
-    }
-
-    BigInt result;      // the resultant difference
-    // identify the numbers as `larger` and `smaller`
-    std::string larger, smaller;
-    if (abs(*this) > abs(num)) {
-        larger = this->value;
-        smaller = num.value;
-
-        if (this->sign == '-')      // -larger - -smaller = -result
-            result.sign = '-';
-    }
-    else {
-        larger = num.value;
-        smaller = this->value;
+    BigInt difference;
+    difference.assign_sum(*this, num, true);
 
-        if (num.sign == '+')        // smaller - larger = -result
-            result.sign = '-';
-    }
-    // pad the smaller number with zeroes
-    add_leading_zeroes(smaller, larger.size() - smaller.size());
-
-    result.value = "";  // the value is cleared as the digits will be appended
-    short difference;
-    long i, j;
-    // subtract the two values
-    for (i = larger.size() - 1; i >= 0; i--) {
-        difference = larger[i] - smaller[i];
-        if (difference < 0) {
-            for (j = i - 1; j >= 0; j--) {
-                if (larger[j] != '0') {
-                    larger[j]--;    // borrow from the j-th digit
-                    break;
-                }
-            }
-            j++;
-            while (j != i) {
-                larger[j] = '9';    // add the borrow and take away 1
-                j++;
-            }
-            difference += 10;   // add the borrow
-        }
-        result.value = std::to_string(difference) + result.value;
-    }
-    strip_leading_zeroes(result.value);
-
-    // if the result is 0, set its sign as +
-    if (result.value == "0")
-        result.sign = '+';
-
-    return result;
+    return difference;
 }
 
 
 /*
     BigInt * BigInt
     ---------------
-    Computes the product of two BigInts using Karatsuba's algorithm.
+    Computes the product of two BigInts using the schoolbook method, Karatsuba's
+    algorithm, Toom-Cook multiplication or number-theoretic transforms,
+    depending on their lengths. A BigInt multiplied by itself is squared.
     The operand on the RHS of the product is `num`.
 */
 
 BigInt BigInt::operator*(const BigInt& num) const {
-    if (*this == 0 or num == 0)
-        return BigInt(0);
-    if (*this == 1)
-        return num;
-    if (num == 1)
-     return *this;
-
     BigInt product;
-    if (abs(*this) <= FLOOR_SQRT_LLONG_MAX and abs(num) <= FLOOR_SQRT_LLONG_MAX)
-        product = std::stoll(this->value) * std::stoll(num.value);
-    else if (is_power_of_10(this->value)){ // if LHS is a power of 10 do optimised operation 
-        product.value = num.value;
-        product.value.append(this->value.begin() + 1, this->value.end());
-    }
-    else if (is_power_of_10(num.value)){ // if RHS is a power of 10 do optimised operation 
-        product.value = this->value;
-        product.value.append(num.value.begin() + 1, num.value.end());
-    }
-    else {
-        // identify the numbers as `larger` and `smaller`
-        std::string larger, smaller;
-        std::tie(larger, smaller) = get_larger_and_smaller(this->value, num.value);
+    multiply_limbs(product.limbs, this->limbs.data(), this->limbs.size(),
+                   num.limbs.data(), num.limbs.size());
 
-        size_t half_length = larger.size() / 2;
-        auto half_length_ceil = (size_t) ceil(larger.size() / 2.0);
+    if (this->sign != num.sign and !product.limbs.empty())
+        product.sign = '-';
 
-        BigInt num1_high, num1_low;
-        num1_high = larger.substr(0, half_length);
-        num1_low = larger.substr(half_length);
+    return product;
+}
 
-        BigInt num2_high, num2_low;
-        num2_high = smaller.substr(0, half_length);
-        num2_low = smaller.substr(half_length);
 
-        strip_leading_zeroes(num1_high.value);
-        strip_leading_zeroes(num1_low.value);
-        strip_leading_zeroes(num2_high.value);
-        strip_leading_zeroes(num2_low.value);
+/*
+    divide
+    ------
+    Helper function that returns the quotient and remainder on dividing the
+    magnitude of the dividend by that of the divisor.
+*/
 
-        BigInt prod_high, prod_mid, prod_low;
-        prod_high = num1_high * num2_high;
-        prod_low = num1_low * num2_low;
-        prod_mid = (num1_high + num1_low) * (num2_high + num2_low)
-                   - prod_high - prod_low;
+std::tuple<BigInt, BigInt> divide(const BigInt& dividend, const BigInt& divisor) {
+    BigInt quotient, remainder;
+    divide_limbs(quotient.limbs, remainder.limbs, dividend.limbs.data(),
+                 dividend.limbs.size(), divisor.limbs.data(), divisor.limbs.size());
 
-        add_trailing_zeroes(prod_high.value, 2 * half_length_ceil);
-        add_trailing_zeroes(prod_mid.value, half_length_ceil);
+    return std::make_tuple(std::move(quotient), std::move(remainder));
+}
 
-        strip_leading_zeroes(prod_high.value);
-        strip_leading_zeroes(prod_mid.value);
-        strip_leading_zeroes(prod_low.value);
 
-        product = prod_high + prod_mid + prod_low;
-    }
-    strip_leading_zeroes(product.value);
+/*
+    divmod
+    ------
+    Returns the quotient and remainder on dividing two BigInts, with the
+    quotient truncated towards zero (as by the `/` operator), so that the
+    remainder has the same sign as the dividend (as by the `%` operator).
+*/
 
-    if (this->sign == num.sign)
-        product.sign = '+';
-    else
-        product.sign = '-';
+std::tuple<BigInt, BigInt> divmod(const BigInt& dividend, const BigInt& divisor) {
+    if (divisor.limbs.empty())
+        throw std::logic_error("Attempted division by zero");
 
-    return product;
+    BigInt quotient, remainder;
+    std::tie(quotient, remainder) = divide(dividend, divisor);
+    if (dividend.sign != divisor.sign and !quotient.limbs.empty())
+        quotient.sign = '-';
+    if (!remainder.limbs.empty())
+        remainder.sign = dividend.sign;
+
+    return std::make_tuple(std::move(quotient), std::move(remainder));
 }
 
 
 /*
-    divide
-    ------
-    Helper function that returns the quotient and remainder on dividing the
-    dividend by the divisor, when the divisor is 1 to 10 times the dividend.
+    divmod (Integer)
+    ----------------
 */
 
-std::tuple<BigInt, BigInt> divide(const BigInt& dividend, const BigInt& divisor) {
-    BigInt quotient, remainder, temp;
+std::tuple<BigInt, BigInt> divmod(const BigInt& dividend, const long long& divisor) {
+    Limb divisor_limbs[2];
+    size_t divisor_size = magnitude_to_limbs(divisor, divisor_limbs);
+    if (divisor_size == 0)
+        throw std::logic_error("Attempted division by zero");
 
-    temp = divisor;
-    quotient = 1;
-    while (temp < dividend) {
-        quotient++;
-        temp += divisor;
-    }
-    if (temp > dividend) {
-        quotient--;
-        remainder = dividend - (temp - divisor);
+    // the integer's limbs are used directly, without making a BigInt of it
+    BigInt quotient, remainder;
+    divide_limbs(quotient.limbs, remainder.limbs, dividend.limbs.data(),
+                 dividend.limbs.size(), divisor_limbs, divisor_size);
+    if ((dividend.sign == '-') != (divisor < 0) and !quotient.limbs.empty())
+        quotient.sign = '-';
+    if (!remainder.limbs.empty())
+        remainder.sign = dividend.sign;
+
+    return std::make_tuple(std::move(quotient), std::move(remainder));
+}
+
+std::tuple<BigInt, BigInt> divmod(const long long& dividend, const BigInt& divisor) {
+    return divmod(BigInt(dividend), divisor);
+}
+
+
+/*
+    divmod_floor
+    ------------
+    Returns the quotient and remainder on dividing two BigInts, with the
+    quotient rounded down, so that the remainder has the same sign as the
+    divisor.
+*/
+
+std::tuple<BigInt, BigInt> divmod_floor(const BigInt& dividend, const BigInt& divisor) {
+    BigInt quotient, remainder;
+    std::tie(quotient, remainder) = divmod(dividend, divisor);
+    if (remainder != 0 and (remainder < 0) != (divisor < 0)) {
+        quotient -= 1;
+        remainder += divisor;
     }
 
-    return std::make_tuple(quotient, remainder);
+    return std::make_tuple(std::move(quotient), std::move(remainder));
 }
 
 
 /*
-    BigInt / BigInt
-    ---------------
-    Computes the quotient of two BigInts using the long-division method.
-    The operand on the RHS of the division (the divisor) is `num`.
+    divmod_floor (Integer)
+    ----------------------
 */
 
-BigInt BigInt::operator/(const BigInt& num) const {
-    BigInt abs_dividend = abs(*this);
-    BigInt abs_divisor = abs(num);
+std::tuple<BigInt, BigInt> divmod_floor(const BigInt& dividend, const long long& divisor) {
+    return divmod_floor(dividend, BigInt(divisor));
+}
 
-    if (num == 0)
-        throw std::logic_error("Attempted division by zero");
-    if (abs_dividend < abs_divisor)
-        return BigInt(0);
-    if (num == 1)
-        return *this;
-    if (num == -1)
-        return -(*this);
+std::tuple<BigInt, BigInt> divmod_floor(const long long& dividend, const BigInt& divisor) {
+    return divmod_floor(BigInt(dividend), divisor);
+}
 
-    BigInt quotient;
-    if (abs_dividend <= LLONG_MAX and abs_divisor <= LLONG_MAX)
-        quotient = std::stoll(abs_dividend.value) / std::stoll(abs_divisor.value);
-    else if (abs_dividend == abs_divisor)
-        quotient = 1;
-    else if (is_power_of_10(abs_divisor.value)) { // if divisor is a power of 10 do optimised calculation
-        size_t digits_in_quotient = abs_dividend.value.size() - abs_divisor.value.size() + 1;
-        quotient.value = abs_dividend.value.substr(0, digits_in_quotient);
-    }
-    else {
-        quotient.value = "";    // the value is cleared as digits will be appended
-        BigInt chunk, chunk_quotient, chunk_remainder;
-        size_t chunk_index = 0;
-        chunk_remainder.value = abs_dividend.value.substr(chunk_index, abs_divisor.value.size() - 1);
-        chunk_index = abs_divisor.value.size() - 1;
-        while (chunk_index < abs_dividend.value.size()) {
-            chunk.value = chunk_remainder.value.append(1, abs_dividend.value[chunk_index]);
-            chunk_index++;
-            while (chunk < abs_divisor) {
-                quotient.value += "0";
-                if (chunk_index < abs_dividend.value.size()) {
-                    chunk.value.append(1, abs_dividend.value[chunk_index]);
-                    chunk_index++;
-                }
-                else
-                    break;
-            }
-            if (chunk == abs_divisor) {
-                quotient.value += "1";
-                chunk_remainder = 0;
-            }
-            else if (chunk > abs_divisor) {
-                strip_leading_zeroes(chunk.value);
-                std::tie(chunk_quotient, chunk_remainder) = divide(chunk, abs_divisor);
-                quotient.value += chunk_quotient.value;
-            }
-        }
+
+/*
+    divmod_ceil
+    -----------
+    Returns the quotient and remainder on dividing two BigInts, with the
+    quotient rounded up, so that the remainder has the opposite sign to the
+    divisor.
+*/
+
+std::tuple<BigInt, BigInt> divmod_ceil(const BigInt& dividend, const BigInt& divisor) {
+    BigInt quotient, remainder;
+    std::tie(quotient, remainder) = divmod(dividend, divisor);
+    if (remainder != 0 and (remainder < 0) == (divisor < 0)) {
+        quotient += 1;
+        remainder -= divisor;
     }
-    strip_leading_zeroes(quotient.value);
 
-    if (this->sign == num.sign)
-        quotient.sign = '+';
-    else
-        quotient.sign = '-';
+    return std::make_tuple(std::move(quotient), std::move(remainder));
+}
 
-    return quotient;
+
+/*
+    divmod_ceil (Integer)
+    ---------------------
+*/
+
+std::tuple<BigInt, BigInt> divmod_ceil(const BigInt& dividend, const long long& divisor) {
+    return divmod_ceil(dividend, BigInt(divisor));
+}
+
+std::tuple<BigInt, BigInt> divmod_ceil(const long long& dividend, const BigInt& divisor) {
+    return divmod_ceil(BigInt(dividend), divisor);
+}
+
+
+/*
+    BigInt / BigInt
+    ---------------
+    Computes the quotient of two BigInts using long division on their limbs.
+    The operand on the RHS of the division (the divisor) is `num`.
+*/
+
+BigInt BigInt::operator/(const BigInt& num) const {
+    return std::get<0>(divmod(*this, num));
 }
 
 
@@ -313,45 +234,71 @@ BigInt BigInt::operator/(const BigInt& num) const {
 */
 
 BigInt BigInt::operator%(const BigInt& num) const {
-    BigInt abs_dividend = abs(*this);
-    BigInt abs_divisor = abs(num);
+    return std::get<1>(divmod(*this, num));
+}
 
-    if (abs_divisor == 0)
-        throw std::logic_error("Attempted division by zero");
-    if (abs_divisor == 1 or abs_divisor == abs_dividend)
-        return BigInt(0);
-
-    BigInt remainder;
-    if (abs_dividend <= LLONG_MAX and abs_divisor <= LLONG_MAX)
-        remainder = std::stoll(abs_dividend.value) % std::stoll(abs_divisor.value);
-    else if (abs_dividend < abs_divisor)
-        remainder = abs_dividend;
-    else if (is_power_of_10(num.value)){ // if num is a power of 10 use optimised calculation
-        size_t no_of_zeroes = num.value.size() - 1;
-        remainder.value = abs_dividend.value.substr(abs_dividend.value.size() - no_of_zeroes);
-    } 
-    else {
-        BigInt quotient = abs_dividend / abs_divisor;
-        remainder = abs_dividend - quotient * abs_divisor;
-    }
-    strip_leading_zeroes(remainder.value);
 
-    // remainder has the same sign as that of the dividend
-    remainder.sign = this->sign;
-    if (remainder.value == "0")     // except if its zero
-        remainder.sign = '+';
+/*
+    Temporary BigInt + BigInt
+    -------------------------
+    The sum is accumulated into the limbs of the temporary operand(s).
+*/
+
+BigInt operator+(BigInt&& lhs, const BigInt& rhs) {
+    lhs.assign_sum(lhs, rhs, false);
+
+    return std::move(lhs);
+}
+
+BigInt operator+(const BigInt& lhs, BigInt&& rhs) {
+    rhs.assign_sum(lhs, rhs, false);
+
+    return std::move(rhs);
+}
+
+BigInt operator+(BigInt&& lhs, BigInt&& rhs) {
+    lhs.assign_sum(lhs, rhs, false);
 
-    return remainder;
+    return std::move(lhs);
+}
+
+
+/*
+    Temporary BigInt - BigInt
+    -------------------------
+    The difference is accumulated into the limbs of the temporary operand(s).
+*/
+
+BigInt operator-(BigInt&& lhs, const BigInt& rhs) {
+    lhs.assign_sum(lhs, rhs, true);
+
+    return std::move(lhs);
+}
+
+BigInt operator-(const BigInt& lhs, BigInt&& rhs) {
+    rhs.assign_sum(lhs, rhs, true);
+
+    return std::move(rhs);
+}
+
+BigInt operator-(BigInt&& lhs, BigInt&& rhs) {
+    lhs.assign_sum(lhs, rhs, true);
+
+    return std::move(lhs);
 }
 
 
 /*
     BigInt + Integer
     ----------------
+    The integer's limbs are added directly, without making a BigInt of it.
 */
 
 BigInt BigInt::operator+(const long long& num) const {
-    return *this + BigInt(num);
+    BigInt sum;
+    sum.assign_sum(*this, num, false);
+
+    return sum;
 }
 
 
@@ -361,17 +308,22 @@ BigInt BigInt::operator+(const long long& num) const {
 */
 
 BigInt operator+(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) + rhs;
+    return rhs + lhs;
 }
 
 
 /*
     BigInt - Integer
     ----------------
+    The integer's limbs are subtracted directly, without making a BigInt of
+    it.
 */
 
 BigInt BigInt::operator-(const long long& num) const {
-    return *this - BigInt(num);
+    BigInt difference;
+    difference.assign_sum(*this, num, true);
+
+    return difference;
 }
 
 
@@ -381,17 +333,21 @@ BigInt BigInt::operator-(const long long& num) const {
 */
 
 BigInt operator-(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) - rhs;
+    return -(rhs - lhs);
 }
 
 
 /*
     BigInt * Integer
     ----------------
+    Multiplies by the integer's one or two limbs in a single pass.
 */
 
 BigInt BigInt::operator*(const long long& num) const {
-    return *this * BigInt(num);
+    BigInt product;
+    product.assign_product(*this, num);
+
+    return product;
 }
 
 
@@ -401,17 +357,22 @@ BigInt BigInt::operator*(const long long& num) const {
 */
 
 BigInt operator*(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) * rhs;
+    return rhs * lhs;
 }
 
 
 /*
     BigInt / Integer
     ----------------
+    Divides by an integer that fits in a limb in a single pass, and by any
+    other integer without making a BigInt of it.
 */
 
 BigInt BigInt::operator/(const long long& num) const {
-    return *this / BigInt(num);
+    BigInt quotient;
+    quotient.assign_quotient(*this, num);
+
+    return quotient;
 }
 
 
@@ -425,13 +386,33 @@ BigInt operator/(const long long& lhs, const BigInt& rhs) {
 }
 
 
+/*
+    modulo (Integer)
+    ----------------
+    Returns the remainder on dividing a BigInt by an integer, which has the
+    same sign as the BigInt (as with the `%` operator), as an integer. The
+    remainder of a divisor that fits in a limb is found without any
+    allocation.
+*/
+
+long long modulo(const BigInt& dividend, const long long& divisor) {
+    Limb divisor_limbs[2];
+    if (magnitude_to_limbs(divisor, divisor_limbs) != 1)
+        return std::get<1>(divmod(dividend, divisor)).to_long_long();
+
+    long long remainder = modulo_by_limb(dividend.limbs, divisor_limbs[0]);
+
+    return dividend.sign == '-' ? -remainder : remainder;
+}
+
+
 /*
     BigInt % Integer
     ----------------
 */
 
 BigInt BigInt::operator%(const long long& num) const {
-    return *this % BigInt(num);
+    return BigInt(modulo(*this, num));
 }
 
 
@@ -445,6 +426,64 @@ BigInt operator%(const long long& lhs, const BigInt& rhs) {
 }
 
 
+/*
+    Temporary BigInt + Integer
+    --------------------------
+*/
+
+BigInt operator+(BigInt&& lhs, const long long& rhs) {
+    lhs.assign_sum(lhs, rhs, false);
+
+    return std::move(lhs);
+}
+
+
+/*
+    Temporary BigInt - Integer
+    --------------------------
+*/
+
+BigInt operator-(BigInt&& lhs, const long long& rhs) {
+    lhs.assign_sum(lhs, rhs, true);
+
+    return std::move(lhs);
+}
+
+
+/*
+    Temporary BigInt * Integer
+    --------------------------
+    A temporary multiplied by an integer that fits in a limb is scaled in
+    place, so that chains of scaled sums (such as `a * 3 + b * 5 - c`) only
+    allocate for each scaled term.
+*/
+
+BigInt operator*(BigInt&& lhs, const long long& rhs) {
+    lhs.assign_product(lhs, rhs);
+
+    return std::move(lhs);
+}
+
+BigInt operator*(const long long& lhs, BigInt&& rhs) {
+    rhs.assign_product(rhs, lhs);
+
+    return std::move(rhs);
+}
+
+
+/*
+    Temporary BigInt / Integer
+    --------------------------
+    A temporary divided by an integer that fits in a limb is divided in place.
+*/
+
+BigInt operator/(BigInt&& lhs, const long long& rhs) {
+    lhs.assign_quotient(lhs, rhs);
+
+    return std::move(lhs);
+}
+
+
 /*
     BigInt + String
     ---------------
@@ -544,4 +583,28 @@ BigInt operator%(const std::string& lhs, const BigInt& rhs) {
     return BigInt(lhs) % rhs;
 }
 
+
+/*
+    Temporary BigInt + String
+    -------------------------
+*/
+
+BigInt operator+(BigInt&& lhs, const std::string& rhs) {
+    lhs.assign_sum(lhs, BigInt(rhs), false);
+
+    return std::move(lhs);
+}
+
+
+/*
+    Temporary BigInt - String
+    -------------------------
+*/
+
+BigInt operator-(BigInt&& lhs, const std::string& rhs) {
+    lhs.assign_sum(lhs, BigInt(rhs), true);
+
+    return std::move(lhs);
+}
+
 #endif  // BIG_INT_BINARY_ARITHMETIC_OPERATORS_HPP
@@ -7,20 +7,95 @@
 #ifndef BIG_INT_IO_STREAM_OPERATORS_HPP
 #define BIG_INT_IO_STREAM_OPERATORS_HPP
 
+#include <cctype>
+#include <string>
+
 #include "BigInt.hpp"
+#include "algorithms/radix.hpp"
 #include "constructors/constructors.hpp"
+#include "functions/conversion.hpp"
 #include "operators/assignment.hpp"
 
 
+/*
+    stream_base
+    -----------
+    Returns the base that integers are formatted in by a stream: 16 with
+    std::hex, 8 with std::oct and 10 otherwise.
+*/
+
+int stream_base(const std::ios_base& stream) {
+    std::ios_base::fmtflags base_flags = stream.flags() & std::ios_base::basefield;
+    if (base_flags == std::ios_base::hex)
+        return 16;
+    if (base_flags == std::ios_base::oct)
+        return 8;
+
+    return 10;
+}
+
+
 /*
     BigInt from input stream
     ------------------------
+    Reads a BigInt like an integer: after any whitespace (unless std::noskipws
+    is set), an optional sign and the digits in the base of the stream (see
+    stream_base), which in hex may follow a prefix of 0x, up to the first
+    character that is not one of them. The digits are taken straight from the
+    stream's buffer and converted as they arrive, so a long BigInt is never
+    held as a string.
+    NOTE: If there are no digits, the BigInt is set to zero and failbit is set
+    on the stream.
 */
 
 std::istream& operator>>(std::istream& in, BigInt& num) {
-    std::string input;
-    in >> input;
-    num = BigInt(input);  // remove sign from value and set sign, if exists
+    std::istream::sentry sentry(in);
+    if (!sentry)
+        return in;
+
+    typedef std::istream::traits_type traits;
+    std::streambuf* buffer = in.rdbuf();
+    int base = stream_base(in);
+    DigitAccumulator digits(base);
+    bool has_digits = false;
+
+    traits::int_type next = buffer->sgetc();
+    char sign = '+';
+    if (next == '+' or next == '-') {
+        sign = traits::to_char_type(next);
+        next = buffer->snextc();
+    }
+    if (base == 16 and next == '0') {
+        digits.push_back('0');
+        has_digits = true;
+        next = buffer->snextc();
+        if (next == 'x' or next == 'X') {
+            // the prefix must be followed by digits
+            has_digits = false;
+            next = buffer->snextc();
+        }
+    }
+    while (!traits::eq_int_type(next, traits::eof())
+            and digit_value(traits::to_char_type(next)) < base) {
+        digits.push_back(traits::to_char_type(next));
+        has_digits = true;
+        next = buffer->snextc();
+    }
+
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    if (traits::eq_int_type(next, traits::eof()))
+        state |= std::ios_base::eofbit;
+    if (has_digits) {
+        digits.finish(num.limbs);
+        // zero is never negative
+        num.sign = (sign == '-' and !num.limbs.empty()) ? '-' : '+';
+    }
+    else {
+        num.limbs.clear();
+        num.sign = '+';
+        state |= std::ios_base::failbit;
+    }
+    in.setstate(state);
 
     return in;
 }
@@ -29,12 +104,36 @@ std::istream& operator>>(std::istream& in, BigInt& num) {
 /*
     BigInt to output stream
     -----------------------
+    Writes a BigInt in the base of the stream (see stream_base), like an
+    integer: prefixed with 0x in hex and 0 in octal with std::showbase (unless
+    it is zero), with a + sign if positive with std::showpos, and in uppercase
+    with std::uppercase.
 */
 
 std::ostream& operator<<(std::ostream& out, const BigInt& num) {
-    if (num.sign == '-')
-        out << num.sign;
-    out << num.value;
+    std::ios_base::fmtflags flags = out.flags();
+    int base = stream_base(out);
+    std::string digits = num.to_string(base);
+
+    std::string prefix;
+    if (flags & std::ios_base::showpos and num.sign == '+')
+        prefix = "+";
+    if (flags & std::ios_base::showbase and !num.limbs.empty()) {
+        if (base == 16)
+            prefix += "0x";
+        else if (base == 8)
+            prefix += "0";
+    }
+    if (!prefix.empty()) {
+        // the prefix goes after the sign
+        size_t start = num.sign == '-' ? 1 : 0;
+        digits.insert(start, prefix);
+    }
+    if (flags & std::ios_base::uppercase)
+        for (char& digit : digits)
+            digit = (char) std::toupper(digit);
+
+    out << digits;
 
     return out;
 }
@@ -2,14 +2,62 @@
     ===========================================================================
     Relational operators
     ===========================================================================
-    All operators depend on the '<' and/or '==' operator(s).
+    All operators depend on the three-way comparison functions, which compare
+    the limbs in place, without making any copies of their operands.
 */
 
 #ifndef BIG_INT_RELATIONAL_OPERATORS_HPP
 #define BIG_INT_RELATIONAL_OPERATORS_HPP
 
 #include "BigInt.hpp"
-#include "operators/unary_arithmetic.hpp"
+#include "functions/utility.hpp"
+
+
+/*
+    compare_abs
+    -----------
+    Compares the absolute values of a BigInt and a BigInt or an integer,
+    returning -1, 0 or 1 if the first is less than, equal to or greater than
+    the second respectively.
+*/
+
+int compare_abs(const BigInt& num1, const BigInt& num2) {
+    return compare_limbs(num1.limbs, num2.limbs);
+}
+
+int compare_abs(const BigInt& num1, const long long& num2) {
+    Limb num2_limbs[2];
+    size_t size2 = magnitude_to_limbs(num2, num2_limbs);
+
+    return compare_limbs(num1.limbs.data(), num1.limbs.size(), num2_limbs, size2);
+}
+
+
+/*
+    compare
+    -------
+    Compares a BigInt with a BigInt or an integer, returning -1, 0 or 1 if the
+    first is less than, equal to or greater than the second respectively.
+*/
+
+int compare(const BigInt& num1, const BigInt& num2) {
+    if (num1.sign != num2.sign)
+        return num1.sign == '-' ? -1 : 1;
+
+    // the larger magnitude is the smaller number when both are negative
+    int result = compare_abs(num1, num2);
+    return num1.sign == '+' ? result : -result;
+}
+
+int compare(const BigInt& num1, const long long& num2) {
+    // zero is always positive, so the signs differ only across zero
+    char sign2 = num2 < 0 ? '-' : '+';
+    if (num1.sign != sign2)
+        return num1.sign == '-' ? -1 : 1;
+
+    int result = compare_abs(num1, num2);
+    return num1.sign == '+' ? result : -result;
+}
 
 
 /*
@@ -18,7 +66,7 @@
 */
 
 bool BigInt::operator==(const BigInt& num) const {
-    return (sign == num.sign) and (value == num.value);
+    return (sign == num.sign) and (limbs == num.limbs);
 }
 
 
@@ -38,18 +86,7 @@ bool BigInt::operator!=(const BigInt& num) const {
 */
 
 bool BigInt::operator<(const BigInt& num) const {
-    if (sign == num.sign) {
-        if (sign == '+') {
-            if (value.length() == num.value.length())
-                return value < num.value;
-            else
-                return value.length() < num.value.length();
-        }
-        else
-            return -(*this) > -num;
-    }
-    else
-        return sign == '-';
+    return compare(*this, num) < 0;
 }
 
 
@@ -59,7 +96,7 @@ bool BigInt::operator<(const BigInt& num) const {
 */
 
 bool BigInt::operator>(const BigInt& num) const {
-    return !((*this < num) or (*this == num));
+    return compare(*this, num) > 0;
 }
 
 
@@ -69,7 +106,7 @@ bool BigInt::operator>(const BigInt& num) const {
 */
 
 bool BigInt::operator<=(const BigInt& num) const {
-    return (*this < num) or (*this == num);
+    return compare(*this, num) <= 0;
 }
 
 
@@ -79,7 +116,7 @@ bool BigInt::operator<=(const BigInt& num) const {
 */
 
 bool BigInt::operator>=(const BigInt& num) const {
-    return !(*this < num);
+    return compare(*this, num) >= 0;
 }
 
 
@@ -89,7 +126,7 @@ bool BigInt::operator>=(const BigInt& num) const {
 */
 
 bool BigInt::operator==(const long long& num) const {
-    return *this == BigInt(num);
+    return compare(*this, num) == 0;
 }
 
 
@@ -99,7 +136,7 @@ bool BigInt::operator==(const long long& num) const {
 */
 
 bool operator==(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) == rhs;
+    return compare(rhs, lhs) == 0;
 }
 
 
@@ -109,7 +146,7 @@ bool operator==(const long long& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator!=(const long long& num) const {
-    return !(*this == BigInt(num));
+    return compare(*this, num) != 0;
 }
 
 
@@ -119,7 +156,7 @@ bool BigInt::operator!=(const long long& num) const {
 */
 
 bool operator!=(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) != rhs;
+    return compare(rhs, lhs) != 0;
 }
 
 
@@ -129,7 +166,7 @@ bool operator!=(const long long& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator<(const long long& num) const {
-    return *this < BigInt(num);
+    return compare(*this, num) < 0;
 }
 
 
@@ -139,7 +176,7 @@ bool BigInt::operator<(const long long& num) const {
 */
 
 bool operator<(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) < rhs;
+    return compare(rhs, lhs) > 0;
 }
 
 
@@ -149,7 +186,7 @@ bool operator<(const long long& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator>(const long long& num) const {
-    return *this > BigInt(num);
+    return compare(*this, num) > 0;
 }
 
 
@@ -159,7 +196,7 @@ bool BigInt::operator>(const long long& num) const {
 */
 
 bool operator>(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) > rhs;
+    return compare(rhs, lhs) < 0;
 }
 
 
@@ -169,7 +206,7 @@ bool operator>(const long long& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator<=(const long long& num) const {
-    return !(*this > BigInt(num));
+    return compare(*this, num) <= 0;
 }
 
 
@@ -179,7 +216,7 @@ bool BigInt::operator<=(const long long& num) const {
 */
 
 bool operator<=(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) <= rhs;
+    return compare(rhs, lhs) >= 0;
 }
 
 
@@ -189,7 +226,7 @@ bool operator<=(const long long& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator>=(const long long& num) const {
-    return !(*this < BigInt(num));
+    return compare(*this, num) >= 0;
 }
 
 
@@ -199,7 +236,7 @@ bool BigInt::operator>=(const long long& num) const {
 */
 
 bool operator>=(const long long& lhs, const BigInt& rhs) {
-    return BigInt(lhs) >= rhs;
+    return compare(rhs, lhs) <= 0;
 }
 
 
@@ -209,7 +246,7 @@ bool operator>=(const long long& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator==(const std::string& num) const {
-    return *this == BigInt(num);
+    return compare(*this, BigInt(num)) == 0;
 }
 
 
@@ -219,7 +256,7 @@ bool BigInt::operator==(const std::string& num) const {
 */
 
 bool operator==(const std::string& lhs, const BigInt& rhs) {
-    return BigInt(lhs) == rhs;
+    return compare(rhs, BigInt(lhs)) == 0;
 }
 
 
@@ -229,7 +266,7 @@ bool operator==(const std::string& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator!=(const std::string& num) const {
-    return !(*this == BigInt(num));
+    return compare(*this, BigInt(num)) != 0;
 }
 
 
@@ -239,7 +276,7 @@ bool BigInt::operator!=(const std::string& num) const {
 */
 
 bool operator!=(const std::string& lhs, const BigInt& rhs) {
-    return BigInt(lhs) != rhs;
+    return compare(rhs, BigInt(lhs)) != 0;
 }
 
 
@@ -249,7 +286,7 @@ bool operator!=(const std::string& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator<(const std::string& num) const {
-    return *this < BigInt(num);
+    return compare(*this, BigInt(num)) < 0;
 }
 
 
@@ -259,7 +296,7 @@ bool BigInt::operator<(const std::string& num) const {
 */
 
 bool operator<(const std::string& lhs, const BigInt& rhs) {
-    return BigInt(lhs) < rhs;
+    return compare(rhs, BigInt(lhs)) > 0;
 }
 
 
@@ -269,7 +306,7 @@ bool operator<(const std::string& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator>(const std::string& num) const {
-    return *this > BigInt(num);
+    return compare(*this, BigInt(num)) > 0;
 }
 
 
@@ -279,7 +316,7 @@ bool BigInt::operator>(const std::string& num) const {
 */
 
 bool operator>(const std::string& lhs, const BigInt& rhs) {
-    return BigInt(lhs) > rhs;
+    return compare(rhs, BigInt(lhs)) < 0;
 }
 
 
@@ -289,7 +326,7 @@ bool operator>(const std::string& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator<=(const std::string& num) const {
-    return !(*this > BigInt(num));
+    return compare(*this, BigInt(num)) <= 0;
 }
 
 
@@ -299,7 +336,7 @@ bool BigInt::operator<=(const std::string& num) const {
 */
 
 bool operator<=(const std::string& lhs, const BigInt& rhs) {
-    return BigInt(lhs) <= rhs;
+    return compare(rhs, BigInt(lhs)) >= 0;
 }
 
 
@@ -309,7 +346,7 @@ bool operator<=(const std::string& lhs, const BigInt& rhs) {
 */
 
 bool BigInt::operator>=(const std::string& num) const {
-    return !(*this < BigInt(num));
+    return compare(*this, BigInt(num)) >= 0;
 }
 
 
@@ -319,7 +356,7 @@ bool BigInt::operator>=(const std::string& num) const {
 */
 
 bool operator>=(const std::string& lhs, const BigInt& rhs) {
-    return BigInt(lhs) >= rhs;
+    return compare(rhs, BigInt(lhs)) <= 0;
 }
 
 #endif  // BIG_INT_RELATIONAL_OPERATORS_HPP
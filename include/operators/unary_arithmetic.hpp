@@ -7,6 +7,8 @@
 #ifndef BIG_INT_UNARY_ARITHMETIC_OPERATORS_HPP
 #define BIG_INT_UNARY_ARITHMETIC_OPERATORS_HPP
 
+#include <utility>
+
 #include "BigInt.hpp"
 #include "constructors/constructors.hpp"
 
@@ -33,8 +35,8 @@ BigInt BigInt::operator+() const {
 BigInt BigInt::operator-() const {
     BigInt temp;
 
-    temp.value = value;
-    if (value != "0") {
+    temp.limbs = limbs;
+    if (!limbs.empty()) {
         if (sign == '+')
             temp.sign = '-';
         else
@@ -44,4 +46,18 @@ BigInt BigInt::operator-() const {
     return temp;
 }
 
+
+/*
+    -BigInt (temporary)
+    -------------------
+    Returns the negative of a temporary BigInt, reusing its limbs.
+*/
+
+BigInt operator-(BigInt&& num) {
+    if (!num.limbs.empty())
+        num.sign = num.sign == '+' ? '-' : '+';
+
+    return std::move(num);
+}
+
 #endif  // BIG_INT_UNARY_ARITHMETIC_OPERATORS_HPP
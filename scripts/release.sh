@@ -26,11 +26,22 @@ comment="\
 printf "$comment" >> "$release_file"
 
 # topologically sorted list of header files
-header_files="BigInt.hpp \
+header_files="LimbResource.hpp \
+    LimbVector.hpp \
+    BigInt.hpp \
+    algorithms/words.hpp \
     functions/utility.hpp \
+    algorithms/addition.hpp \
+    algorithms/thresholds.hpp \
+    algorithms/parallel.hpp \
+    algorithms/ntt.hpp \
+    algorithms/multiplication.hpp \
+    algorithms/division.hpp \
+    algorithms/radix.hpp \
     functions/random.hpp \
     constructors/constructors.hpp \
     functions/conversion.hpp \
+    functions/serialization.hpp \
     operators/assignment.hpp \
     operators/unary_arithmetic.hpp \
     operators/relational.hpp \
@@ -0,0 +1,101 @@
+#include "constructors/constructors.hpp"
+#include "functions/math.hpp"
+#include "operators/binary_arithmetic.hpp"
+#include "operators/io_stream.hpp"
+#include "operators/relational.hpp"
+
+#include "third_party/catch.hpp"
+
+
+// multiplies `num1` by `num2` using one thread, and then using `threads`
+// threads, and requires both products to be the same
+void require_same_products(const BigInt& num1, const BigInt& num2,
+        unsigned threads) {
+    set_multiplication_threads(1);
+    BigInt serial_product = num1 * num2;
+    set_multiplication_threads(threads);
+    BigInt parallel_product = num1 * num2;
+    set_multiplication_threads(1);
+
+    REQUIRE(parallel_product == serial_product);
+    // every thread that was started has been given back
+    REQUIRE(available_threads() == 0);
+}
+
+
+TEST_CASE("Multiplication using several threads", "[algorithms][parallel]") {
+    BigInt pow3 = pow(BigInt(3), 40000);    // 1986 limbs
+    BigInt pow7 = pow(BigInt(7), 30000);    // 2634 limbs
+
+    SECTION("Toom-Cook multiplication") {
+        require_same_products(pow3 - 1, pow7 + 1, 4);
+        require_same_products(pow7 - 1, pow7 - 1, 4);
+    }
+
+    SECTION("NTT multiplication") {
+        BigInt num1 = pow(pow3, 4) + 1, num2 = pow(pow7, 3) - 1;
+        require_same_products(num1, num2, 2);
+        require_same_products(num1, num2, 3);
+        require_same_products(num2, num2, 8);
+    }
+
+    SECTION("NTT multiplication long enough to split its transforms") {
+        BigInt num = pow(pow7 - 1, 26);     // 68484 limbs
+        require_same_products(num, num + 1, 4);
+    }
+
+    SECTION("Unbalanced multiplication") {
+        BigInt num = pow(pow3 + 1, 6);
+        require_same_products(num * num, pow7 - 1, 4);
+        require_same_products(pow7 - 1, num, 3);
+    }
+}
+
+TEST_CASE("Multiplication using all hardware threads",
+        "[algorithms][parallel]") {
+    BigInt num = pow(BigInt(5), 100000) + 1;
+    require_same_products(num, num - 1, 0);
+}
+
+TEST_CASE("Multiplication using several threads within a LimbArena",
+        "[algorithms][parallel]") {
+    BigInt num1 = pow(BigInt(3), 100000) - 1, num2 = pow(BigInt(3), 100000) + 1;
+    set_multiplication_threads(1);
+    BigInt expected = num1 * num2;
+
+    // the threads allocate from the heap, while the calling thread still
+    // allocates from the arena
+    {
+        LimbArena arena;
+        set_multiplication_threads(4);
+        BigInt product = num1 * num2;
+        set_multiplication_threads(1);
+        REQUIRE(product == expected);
+        REQUIRE(product == pow(BigInt(3), 200000) - 1);
+    }
+}
+
+TEST_CASE("Unbalanced multiplication using several threads into a product "
+          "within a LimbArena", "[algorithms][parallel]") {
+    LimbVector num1(40000), num2(400);
+    for (size_t i = 0; i < num1.size(); i++)
+        num1[i] = (Limb) (i * 2654435761u + 1);
+    for (size_t i = 0; i < num2.size(); i++)
+        num2[i] = (Limb) (i * 40503u + 7);
+    LimbVector expected;
+    set_multiplication_threads(1);
+    multiply_limbs(expected, num1.data(), num1.size(), num2.data(), num2.size());
+
+    // the product already holds storage from the arena, which only the
+    // calling thread may reallocate
+    {
+        LimbArena arena;
+        LimbVector product(1000, 1);
+        set_multiplication_threads(4);
+        multiply_limbs(product, num1.data(), num1.size(), num2.data(),
+                       num2.size());
+        set_multiplication_threads(1);
+        REQUIRE(product == expected);
+        REQUIRE(available_threads() == 0);
+    }
+}
@@ -1,5 +1,10 @@
+#include <algorithm>
 #include <climits>
 #include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 #include "constructors/constructors.hpp"
 #include "operators/io_stream.hpp"
@@ -49,3 +54,42 @@ TEST_CASE("Randomly construct BigInts from integers and strings",
         CHECK(e.what() == std::string("Expected an integer, got \'-4a5b6c\'"));
     }
 }
+
+TEST_CASE("Construct BigInts from long strings", "[constructors][string][big]") {
+    std::mt19937 generator(12345);
+    // lengths on either side of splits into halves, and long enough for
+    // subquadratic multiplications of the halves
+    for (size_t num_digits : {17, 18, 19, 900, 901, 20000, 100000}) {
+        std::string digits(1, (char) ('1' + generator() % 9));
+        while (digits.size() < num_digits)
+            digits += (char) ('0' + generator() % 10);
+
+        BigInt num(digits);
+        REQUIRE(num.to_string() == digits);
+        REQUIRE(BigInt("-" + digits).to_string() == "-" + digits);
+        REQUIRE(BigInt(std::string(num_digits, '0') + digits) == num);
+        REQUIRE(BigInt(digits + std::string(num_digits, '0')).to_string()
+                == digits + std::string(num_digits, '0'));
+
+        // every position of a character within a word of them is checked
+        for (size_t i = 0; i < std::min(num_digits, (size_t) 20); i++) {
+            for (char invalid : {'/', ':', 'a', ' ', '\x80'}) {
+                std::string trouble = digits;
+                trouble[num_digits - 1 - i] = invalid;
+                REQUIRE_THROWS_AS(BigInt(trouble), std::invalid_argument);
+            }
+        }
+    }
+    REQUIRE(BigInt(std::string(1000, '0')) == 0);
+    REQUIRE(BigInt("-" + std::string(1000, '0')).to_string() == "0");
+}
+
+TEST_CASE("Move-construct BigInts", "[constructors][move]") {
+    static_assert(std::is_nothrow_move_constructible<BigInt>::value,
+            "BigInt should be nothrow move constructible");
+
+    BigInt num1("-123456789012345678901234567890");
+    BigInt num2(std::move(num1));
+    REQUIRE(num2 == "-123456789012345678901234567890");
+    REQUIRE(num1 == 0);     // the moved-from BigInt is left as zero
+}
@@ -1,8 +1,14 @@
 #include <climits>
 #include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
 #include "constructors/constructors.hpp"
 #include "functions/conversion.hpp"
+#include "functions/math.hpp"
+#include "functions/random.hpp"
+#include "operators/binary_arithmetic.hpp"
 #include "operators/io_stream.hpp"
 
 #include "third_party/catch.hpp"
@@ -19,6 +25,64 @@ TEST_CASE("Convert BigInt to string", "[conversion][string]") {
     }
 }
 
+TEST_CASE("Convert long BigInts to strings", "[conversion][string][big]") {
+    // powers of 10 (and their neighbours) are split into chunks that are
+    // mostly zeros or nines, which have to be padded to their full width
+    for (size_t exp : {9, 10, 100, 1000, 5000, 40000}) {
+        BigInt power = big_pow10(exp);
+        REQUIRE(power.to_string() == "1" + std::string(exp, '0'));
+        REQUIRE((power - 1).to_string() == std::string(exp, '9'));
+        REQUIRE((-power - 1).to_string() == "-1" + std::string(exp - 1, '0') + "1");
+
+        std::ostringstream stream;
+        stream << power * power;
+        REQUIRE(stream.str() == "1" + std::string(2 * exp, '0'));
+    }
+}
+
+TEST_CASE("Convert BigInts to and from strings in other bases",
+          "[conversion][string][base]") {
+    BigInt num = 255;
+    REQUIRE(num.to_string(2) == "11111111");
+    REQUIRE(num.to_string(8) == "377");
+    REQUIRE(num.to_string(16) == "ff");
+    REQUIRE((-num).to_string(36) == "-73");
+    REQUIRE(BigInt(0).to_string(7) == "0");
+
+    REQUIRE(from_string("11111111", 2) == num);
+    REQUIRE(from_string("0b11111111", 2) == num);
+    REQUIRE(from_string("-0XfF", 16) == -num);
+    REQUIRE(from_string("+zZ", 36) == 1295);
+    REQUIRE(from_string("-000", 3).to_string() == "0");
+
+    REQUIRE_THROWS_AS(num.to_string(1), std::invalid_argument);
+    REQUIRE_THROWS_AS(num.to_string(37), std::invalid_argument);
+    REQUIRE_THROWS_AS(from_string("12", 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(from_string("12", 2), std::invalid_argument);
+    REQUIRE_THROWS_AS(from_string("0x", 16), std::invalid_argument);
+    REQUIRE_THROWS_AS(from_string("0xg", 16), std::invalid_argument);
+    REQUIRE_THROWS_AS(from_string("0b1", 10), std::invalid_argument);
+}
+
+TEST_CASE("Convert long BigInts to and from strings in other bases",
+          "[conversion][string][base][big]") {
+    for (size_t exp : {10, 100, 3000}) {
+        // powers of the base are a one followed by zeros, and their
+        // predecessors are made up of the largest digit
+        for (int base : {2, 3, 8, 10, 16, 32, 36}) {
+            BigInt power = pow(BigInt(base), (int) exp);
+            char largest_digit = "0123456789abcdefghijklmnopqrstuvwxyz"[base - 1];
+            REQUIRE(power.to_string(base) == "1" + std::string(exp, '0'));
+            REQUIRE((1 - power).to_string(base) == "-" + std::string(exp, largest_digit));
+            REQUIRE(from_string("1" + std::string(exp, '0'), base) == power);
+        }
+
+        BigInt num = big_random(exp);
+        for (int base = 2; base <= 36; base++)
+            REQUIRE(from_string(num.to_string(base), base) == num);
+    }
+}
+
 TEST_CASE("Convert BigInt to int", "[conversion][int]") {
     std::random_device generator;
     // uniform distribution of numbers from INT_MIN to INT_MAX:
@@ -51,3 +115,22 @@ TEST_CASE("Convert BigInt to long long int", "[conversion][long long]") {
         REQUIRE(BigInt(rand_num).to_long_long() == rand_num);
     }
 }
+
+TEST_CASE("Convert out of range BigInts to integers",
+          "[conversion][int][long][long long]") {
+    REQUIRE(BigInt(LLONG_MIN).to_long_long() == LLONG_MIN);
+    REQUIRE(BigInt(LLONG_MAX).to_long_long() == LLONG_MAX);
+
+    BigInt num;
+    num = "9223372036854775808";    // LLONG_MAX + 1
+    REQUIRE_THROWS_AS(num.to_long_long(), std::out_of_range);
+    num = "-9223372036854775808";   // LLONG_MIN
+    REQUIRE(num.to_long_long() == LLONG_MIN);
+    num = "-9223372036854775809";   // LLONG_MIN - 1
+    REQUIRE_THROWS_AS(num.to_long_long(), std::out_of_range);
+
+    num = "123456789012345678901234567890";
+    REQUIRE_THROWS_AS(num.to_long_long(), std::out_of_range);
+    REQUIRE_THROWS_AS(BigInt(INT_MAX + 1LL).to_int(), std::out_of_range);
+    REQUIRE_THROWS_AS(BigInt(INT_MIN - 1LL).to_int(), std::out_of_range);
+}
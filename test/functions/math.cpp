@@ -7,6 +7,7 @@
 #include "constructors/constructors.hpp"
 #include "functions/conversion.hpp"
 #include "functions/math.hpp"
+#include "functions/random.hpp"
 #include "operators/binary_arithmetic.hpp"
 #include "operators/io_stream.hpp"
 
@@ -175,6 +176,73 @@ TEST_CASE("pow() with string base", "[functions][math][pow][string]") {
             "4601932346249911644260403539535769743430516736");
 }
 
+TEST_CASE("Base cases for square()", "[functions][math][square]") {
+    BigInt num = 0;
+    REQUIRE(square(num) == 0);
+    num = 1;
+    REQUIRE(square(num) == 1);
+    num = -1;
+    REQUIRE(square(num) == 1);
+    num = -4294967295;
+    REQUIRE(square(num) == "18446744065119617025");
+    num = "-18446744073709551616";
+    REQUIRE(square(num) == "340282366920938463463374607431768211456");
+}
+
+TEST_CASE("square() of big integers", "[functions][math][square][big]") {
+    // operands long enough for every tier of squaring
+    for (size_t num_digits : {10, 800, 5000, 15000, 45000}) {
+        BigInt num = big_random(num_digits);
+
+        REQUIRE(square(num) == (num + 1) * (num - 1) + 1);
+        REQUIRE(square(-num) == square(num));
+        REQUIRE(num * num == square(num));
+    }
+}
+
+TEST_CASE("Base cases for addmul() and submul()", "[functions][math][addmul]") {
+    BigInt acc = 0, num;
+    num = "-18446744073709551616";
+    addmul(acc, num, 0);
+    REQUIRE(acc == 0);
+    addmul(acc, num, num);
+    REQUIRE(acc == "340282366920938463463374607431768211456");
+    submul(acc, num, -num);
+    REQUIRE(acc == "680564733841876926926749214863536422912");
+    submul(acc, 2 * num, num);
+    REQUIRE(acc == 0);
+    addmul(acc, num, 4294967295);
+    REQUIRE(acc == "-79228162495817593519834398720");
+    submul(acc, num, -4294967296LL);
+    REQUIRE(acc == "-158456325010081931113378349056");
+
+    // the accumulator can also be one of the factors
+    acc = -4294967297;
+    addmul(acc, acc, acc);
+    REQUIRE(acc == "18446744078004518912");
+    submul(acc, acc, 1);
+    REQUIRE(acc == 0);
+}
+
+TEST_CASE("addmul() and submul() of big integers", "[functions][math][addmul][big]") {
+    // factors long enough for both schoolbook rows and subquadratic products
+    for (size_t num_digits : {5, 60, 300, 1500, 6000}) {
+        BigInt acc = big_random(num_digits * 2), num1 = big_random(num_digits),
+               num2 = big_random(num_digits / 2 + 1);
+        for (const BigInt& start : {acc, -acc}) {
+            for (const BigInt& factor : {num2, -num2}) {
+                BigInt result = start;
+                addmul(result, num1, factor);
+                REQUIRE(result == start + num1 * factor);
+                submul(result, factor, num1);
+                REQUIRE(result == start);
+                submul(result, num1, 123456789LL);
+                REQUIRE(result == start - num1 * 123456789LL);
+            }
+        }
+    }
+}
+
 TEST_CASE("Base cases for sqrt()", "[functions][math][sqrt]") {
     BigInt num = 0;
     REQUIRE(sqrt(num) == 0);
@@ -0,0 +1,137 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "constructors/constructors.hpp"
+#include "functions/conversion.hpp"
+#include "functions/random.hpp"
+#include "functions/serialization.hpp"
+#include "operators/io_stream.hpp"
+#include "operators/relational.hpp"
+#include "operators/unary_arithmetic.hpp"
+
+#include "third_party/catch.hpp"
+
+
+TEST_CASE("Serialize BigInts to bytes", "[functions][serialization]") {
+    std::vector<uint8_t> buffer(64, 0xff);
+
+    BigInt num;
+    REQUIRE(serialize(num, buffer.data(), buffer.size()) == 16);
+    REQUIRE(std::vector<uint8_t>(buffer.begin(), buffer.begin() + 16)
+            == std::vector<uint8_t>({'B', 'I', 'N', 'T', 1, 0, 0, 0,
+                                     0, 0, 0, 0, 0, 0, 0, 0}));
+
+    num = "-1311768467294899696";     // -0x1234567890abcdf0
+    REQUIRE(serialized_size(num) == 24);
+    REQUIRE(serialize(num, buffer.data(), buffer.size()) == 24);
+    REQUIRE(std::vector<uint8_t>(buffer.begin(), buffer.begin() + 24)
+            == std::vector<uint8_t>({'B', 'I', 'N', 'T', 1, 1, 0, 0,
+                                     2, 0, 0, 0, 0, 0, 0, 0,
+                                     0xf0, 0xcd, 0xab, 0x90,
+                                     0x78, 0x56, 0x34, 0x12}));
+    REQUIRE(buffer[24] == 0xff);    // nothing is written past the end
+
+    REQUIRE_THROWS_AS(serialize(num, buffer.data(), 23),
+                      std::invalid_argument);
+}
+
+TEST_CASE("Deserialize BigInts from bytes", "[functions][serialization]") {
+    std::vector<BigInt> nums = {0, 1, -1, 4294967295LL, -4294967296LL,
+            BigInt("123456789012345678901234567890"),
+            -BigInt("123456789012345678901234567890")};
+    for (int i = 0; i < 10; i++) {
+        nums.push_back(big_random());
+        nums.push_back(-big_random(3000));
+    }
+
+    // serialize all of them back to back
+    std::vector<uint8_t> buffer;
+    for (const BigInt& num: nums) {
+        size_t offset = buffer.size();
+        buffer.resize(offset + serialized_size(num));
+        serialize(num, buffer.data() + offset, buffer.size() - offset);
+    }
+
+    size_t offset = 0;
+    for (const BigInt& num: nums) {
+        BigInt result = deserialize(buffer.data() + offset,
+                                    buffer.size() - offset);
+        REQUIRE(result == num);
+        REQUIRE(result.to_string() == num.to_string());
+        offset += serialized_size(result);
+    }
+    REQUIRE(offset == buffer.size());
+}
+
+TEST_CASE("View serialized BigInts in place", "[functions][serialization]") {
+    BigInt num = -big_random(1000);
+    std::vector<Limb> storage(serialized_size(num) / sizeof(Limb));
+    uint8_t* aligned = reinterpret_cast<uint8_t*>(storage.data());
+    size_t size = serialize(num, aligned, storage.size() * sizeof(Limb));
+
+    BigIntView view(aligned, size);
+    REQUIRE(view.sign() == '-');
+    REQUIRE(view.serialized_size() == size);
+    REQUIRE(view.size() == (size - SERIALIZATION_HEADER_SIZE) / sizeof(Limb));
+    REQUIRE(view.to_big_int() == num);
+    if (LITTLE_ENDIAN_LIMBS)
+        REQUIRE(view.limbs() == reinterpret_cast<const Limb*>(
+                aligned + SERIALIZATION_HEADER_SIZE));
+
+    // a view of limbs that are not aligned copies them out
+    std::vector<uint8_t> unaligned(size + 1);
+    std::memcpy(unaligned.data() + 1, aligned, size);
+    BigIntView unaligned_view(unaligned.data() + 1, size);
+    REQUIRE(unaligned_view.limbs() == nullptr);
+    REQUIRE(unaligned_view.to_big_int() == num);
+    for (size_t i = 0; i < view.size(); i++)
+        REQUIRE(unaligned_view.limb(i) == view.limb(i));
+}
+
+TEST_CASE("Deserialize malformed bytes", "[functions][serialization]") {
+    std::vector<uint8_t> buffer(24);
+    serialize(BigInt("-1311768467294899696"), buffer.data(), buffer.size());
+    REQUIRE_NOTHROW(deserialize(buffer.data(), buffer.size()));
+
+    // truncated
+    REQUIRE_THROWS_AS(deserialize(buffer.data(), 15), std::invalid_argument);
+    REQUIRE_THROWS_AS(deserialize(buffer.data(), 23), std::invalid_argument);
+
+    std::vector<uint8_t> malformed;
+    // wrong magic
+    malformed = buffer;
+    malformed[0] = 'b';
+    REQUIRE_THROWS_AS(deserialize(malformed.data(), malformed.size()),
+                      std::invalid_argument);
+    // unknown version
+    malformed = buffer;
+    malformed[4] = 2;
+    REQUIRE_THROWS_AS(deserialize(malformed.data(), malformed.size()),
+                      std::invalid_argument);
+    // bad sign or reserved bytes
+    malformed = buffer;
+    malformed[5] = 2;
+    REQUIRE_THROWS_AS(deserialize(malformed.data(), malformed.size()),
+                      std::invalid_argument);
+    malformed = buffer;
+    malformed[7] = 1;
+    REQUIRE_THROWS_AS(deserialize(malformed.data(), malformed.size()),
+                      std::invalid_argument);
+    // number of limbs that overflows
+    malformed = buffer;
+    malformed[15] = 0x40;
+    REQUIRE_THROWS_AS(deserialize(malformed.data(), malformed.size()),
+                      std::invalid_argument);
+    // leading zero limb
+    malformed = buffer;
+    malformed[20] = malformed[21] = malformed[22] = malformed[23] = 0;
+    REQUIRE_THROWS_AS(deserialize(malformed.data(), malformed.size()),
+                      std::invalid_argument);
+    // negative zero
+    malformed.assign(buffer.begin(), buffer.begin() + 16);
+    malformed[8] = 0;
+    REQUIRE_THROWS_AS(deserialize(malformed.data(), malformed.size()),
+                      std::invalid_argument);
+}
@@ -0,0 +1,96 @@
+#include <string>
+
+#include "constructors/constructors.hpp"
+#include "functions/math.hpp"
+#include "operators/binary_arithmetic.hpp"
+#include "operators/io_stream.hpp"
+#include "operators/relational.hpp"
+
+#include "third_party/catch.hpp"
+
+
+// counts the limbs allocated and not yet deallocated through it
+class CountingLimbResource : public LimbResource {
+    public:
+        long long allocations = 0;
+        long long limbs_in_use = 0;
+
+        Limb* allocate(size_t count) override {
+            allocations++;
+            limbs_in_use += count;
+            return heap_limb_resource()->allocate(count);
+        }
+
+        void deallocate(Limb* limbs, size_t count) override {
+            limbs_in_use -= count;
+            heap_limb_resource()->deallocate(limbs, count);
+        }
+};
+
+
+TEST_CASE("Limbs are allocated from the current resource",
+        "[memory][limb_resource]") {
+    REQUIRE(current_limb_resource() == heap_limb_resource());
+
+    CountingLimbResource resource;
+    {
+        LimbResourceScope scope(&resource);
+        REQUIRE(current_limb_resource() == &resource);
+
+        // small values are stored inline
+        BigInt small("79228162514264337593543950335");     // 2^96 - 1
+        small = small / 12345 * 678 + 9 - small % 1000;
+        REQUIRE(resource.allocations == 0);
+
+        BigInt big = pow(BigInt("123456789"), 500);
+        big = big * big + big / 987654321;
+        REQUIRE(resource.allocations > 0);
+        REQUIRE(resource.limbs_in_use > 0);
+    }
+    REQUIRE(current_limb_resource() == heap_limb_resource());
+    REQUIRE(resource.limbs_in_use == 0);
+}
+
+TEST_CASE("Temporaries are scaled and divided by integers in place",
+        "[memory][limb_resource][move]") {
+    BigInt num = pow(BigInt(10), 300);
+
+    CountingLimbResource resource;
+    {
+        LimbResourceScope scope(&resource);
+
+        // only the sum allocates, with a spare limb that the rest never needs
+        BigInt result = (num + num) * 3 / 7 * -5;
+        REQUIRE(resource.allocations == 1);
+
+        result *= 11;
+        result /= 13;
+        REQUIRE(resource.allocations == 1);
+
+        LimbResourceScope heap(heap_limb_resource());
+        REQUIRE(result == -(num * 2 * 3 / 7 * 5 * 11 / 13));
+    }
+    REQUIRE(resource.limbs_in_use == 0);
+}
+
+TEST_CASE("Computing with temporaries in a LimbArena",
+        "[memory][limb_resource][arena]") {
+    BigInt num1 = pow(BigInt("98765432123456789"), 700);
+    BigInt num2 = pow(BigInt("12345678987654321"), 650) + 1;
+    BigInt expected = (num1 * num2 + square(num2)) / (num1 - num2);
+
+    BigInt result;
+    {
+        LimbArena arena(16);
+        REQUIRE(current_limb_resource() == &arena);
+
+        // the arena grows past its tiny first block
+        BigInt arena_result = (num1 * num2 + square(num2)) / (num1 - num2);
+        REQUIRE(arena_result == expected);
+
+        LimbResourceScope heap(heap_limb_resource());
+        result = arena_result;
+    }
+    REQUIRE(current_limb_resource() == heap_limb_resource());
+    REQUIRE(result == expected);
+}
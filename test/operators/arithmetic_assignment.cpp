@@ -43,6 +43,34 @@ TEST_CASE("Subtract and assign", "[arithmetic-assignment][operators][subtraction
     REQUIRE(num3 == "-12345678911111111100");
 }
 
+TEST_CASE("Add and subtract in place across signs and carries",
+        "[arithmetic-assignment][operators][addition][subtraction]") {
+    BigInt num1, num2;
+    num1 = "18446744073709551615";  // 2^64 - 1, so every limb carries
+    num1 += 1;
+    REQUIRE(num1 == "18446744073709551616");
+    num1 -= 1;
+    REQUIRE(num1 == "18446744073709551615");
+
+    num2 = "-18446744073709551616";
+    num2 += num1;
+    REQUIRE(num2 == -1);
+    num2 -= num1;
+    REQUIRE(num2 == "-18446744073709551616");
+    num2 += num2;
+    REQUIRE(num2 == "-36893488147419103232");
+    num2 -= num2;
+    REQUIRE(num2 == 0);
+    REQUIRE(num2 == -num2);     // zero is never negative
+
+    BigInt sum;
+    for (int i = 0; i < 1000; i++)
+        sum += num1;
+    for (int i = 0; i < 999; i++)
+        sum -= num1;
+    REQUIRE(sum == num1);
+}
+
 TEST_CASE("Multiply and assign", "[arithmetic-assignment][operators][multiplication]") {
     BigInt num1, num2, num3;
     num1 = "169523540030343";
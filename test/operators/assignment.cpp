@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "constructors/constructors.hpp"
 #include "operators/assignment.hpp"
 #include "operators/io_stream.hpp"
@@ -51,3 +56,55 @@ TEST_CASE("Assigning a BigInt to BigInt", "[assignment][operators]") {
     num2 = BigInt(0);
     REQUIRE(num2 == 0);
 }
+
+TEST_CASE("Move-assigning and swapping BigInts", "[assignment][operators][move]") {
+    static_assert(std::is_nothrow_move_assignable<BigInt>::value,
+            "BigInt should be nothrow move assignable");
+
+    BigInt num1, num2;
+    num1 = "123456789012345678901234567890";
+    num2 = std::move(num1);
+    REQUIRE(num2 == "123456789012345678901234567890");
+    REQUIRE(num1 == 0);     // the moved-from BigInt is left as zero
+
+    num1 = -1234567890;
+    swap(num1, num2);
+    REQUIRE(num1 == "123456789012345678901234567890");
+    REQUIRE(num2 == -1234567890);
+
+    std::vector<BigInt> nums;
+    for (int i = 0; i < 100; i++)
+        nums.push_back(BigInt(std::to_string(i % 7) + "00000000000000000000"));
+    std::sort(nums.begin(), nums.end());
+    for (size_t i = 1; i < nums.size(); i++)
+        REQUIRE(nums[i - 1] <= nums[i]);
+}
+
+TEST_CASE("Assigning BigInts that outgrow or fit in inline storage",
+        "[assignment][operators][move]") {
+    // 2^128 needs one limb more than is stored inline
+    BigInt small("340282366920938463463374607431768211455");   // 2^128 - 1
+    BigInt large("340282366920938463463374607431768211456");    // 2^128
+    REQUIRE(large != small);
+    large = small;
+    REQUIRE(large == "340282366920938463463374607431768211455");
+
+    large = "1234567890123456789012345678901234567890123456789012345678901234567890";
+    small = large;
+    REQUIRE(small == large);
+    small = 42;
+    large = small;
+    REQUIRE(large == 42);
+
+    large = "1234567890123456789012345678901234567890123456789012345678901234567890";
+    swap(small, large);
+    REQUIRE(small == "1234567890123456789012345678901234567890123456789012345678901234567890");
+    REQUIRE(large == 42);
+
+    BigInt moved = std::move(small);
+    REQUIRE(moved == "1234567890123456789012345678901234567890123456789012345678901234567890");
+    REQUIRE(small == 0);
+    small = std::move(large);
+    REQUIRE(small == 42);
+    REQUIRE(large == 0);
+}
@@ -1,3 +1,4 @@
+#include <climits>
 #include <random>
 
 #include "constructors/constructors.hpp"
@@ -5,6 +6,7 @@
 #include "operators/io_stream.hpp"
 #include "operators/relational.hpp"
 #include "operators/binary_arithmetic.hpp"
+#include "functions/random.hpp"
 
 #include "third_party/catch.hpp"
 
@@ -123,6 +125,50 @@ TEST_CASE("Chaining addition and subtraction",
     REQUIRE(num1 - num2 - num3 - num4 == -13298183);
 }
 
+TEST_CASE("Addition and subtraction with temporary operands",
+        "[binary-arithmetic][operators][addition][subtraction][move]") {
+    BigInt num1, num2;
+    num1 = "98765432109876543210987654321";
+    num2 = "-12345678901234567890";
+    REQUIRE((num1 * 2) + num2 == "197530864207407407520740740752");
+    REQUIRE(num2 + (num1 * 2) == "197530864207407407520740740752");
+    REQUIRE((num1 * 2) + (num2 * 2) == "197530864195061728619506172862");
+    REQUIRE((num1 * 2) - num2 == "197530864232098765323209876532");
+    REQUIRE(num2 - (num1 * 2) == "-197530864232098765323209876532");
+    REQUIRE((num2 * 2) - (num2 * 2) == 0);
+    REQUIRE((num1 * 1) + 1 == "98765432109876543210987654322");
+    REQUIRE((num1 * 1) - "98765432109876543210987654321" == 0);
+    REQUIRE(-(num1 + num2) == "-98765432097530864309753086431");
+}
+
+TEST_CASE("Multiplication and division of temporary operands by integers",
+        "[binary-arithmetic][operators][multiplication][division][move]") {
+    BigInt num1, num2;
+    num1 = "98765432109876543210987654321";
+    num2 = "-12345678901234567890";
+    REQUIRE((num1 + num2) * 3 == "296296296292592592929259259293");
+    REQUIRE(-3 * (num1 + num2) == "-296296296292592592929259259293");
+    REQUIRE((num1 + num2) * 123456789012LL
+            == "12193263112143880521247187805327767096172");
+    REQUIRE((num1 + num2) * 0 == 0);
+    REQUIRE((num1 - num1) * -5 == 0);
+    REQUIRE(num1 * 3 + num2 * 5 - num1 == "197530864158024691915802469192");
+    REQUIRE((num1 + num2) / 7 == "14109347442504409187107583775");
+    REQUIRE((num2 * 1) / -10 == "1234567890123456789");
+    REQUIRE((num1 + num2) / 123456789012LL == "800000007192240065");
+    REQUIRE((num2 * 1) / 1234567890123456789LL == -10);
+    REQUIRE_THROWS_AS((num1 * 1) / 0, std::logic_error);
+
+    BigInt num3 = num1;
+    num3 *= -7;
+    REQUIRE(num3 == "-691358024769135802476913580247");
+    num3 /= -7;
+    REQUIRE(num3 == num1);
+    num3 *= 98765432109876LL;
+    num3 /= 98765432109876LL;
+    REQUIRE(num3 == num1);
+}
+
 TEST_CASE("Chaining multiplication, division and modulo",
         "[binary-arithmetic][operators][multiplication][division][modulo]") {
     BigInt num1 = 313233343536373839;
@@ -284,6 +330,68 @@ TEST_CASE("Multiplication of big numbers",
     REQUIRE(num1 * num2 == big_pow10(43326) + big_pow10(23450));
 }
 
+TEST_CASE("Multiplication of huge numbers",
+        "[binary-arithmetic][operators][multiplication][big]") {
+    // operands long enough for Karatsuba's algorithm, both Toom-Cook tiers and
+    // number-theoretic transforms
+    for (size_t num_digits : {500, 5000, 25000, 90000}) {
+        BigInt num1 = big_random(num_digits);
+        BigInt num2 = -big_random(num_digits * 2 / 3);
+        BigInt num3 = big_random(num_digits / 3);
+
+        REQUIRE((num1 + num2) * (num1 - num2) == num1 * num1 - num2 * num2);
+        REQUIRE((num1 * num2) * num3 == num1 * (num2 * num3));
+        REQUIRE((num1 + num3) * num2 == num1 * num2 + num3 * num2);
+    }
+}
+
+TEST_CASE("Multiplication of operands of different lengths",
+        "[binary-arithmetic][operators][multiplication][big]") {
+    // (10^m - 1) * (10^n - 1) has every limb of the partial products carry
+    for (size_t m : {300, 700, 1500}) {
+        for (size_t n : {(size_t) 250, m / 2 + 1, m - 1, m}) {
+            BigInt nines1 = big_pow10(m) - 1, nines2 = big_pow10(n) - 1;
+            REQUIRE(nines1 * nines2 == big_pow10(m + n) - big_pow10(m) - big_pow10(n) + 1);
+            REQUIRE(nines1 * nines1 == big_pow10(2 * m) - 2 * big_pow10(m) + 1);
+
+            BigInt num1 = big_random(m), num2 = -big_random(n);
+            REQUIRE(num1 * num2 / num2 == num1);
+            REQUIRE(num1 * num2 == num2 * num1);
+        }
+    }
+
+    // operands long enough for Toom-Cook multiplication, multiplied in chunks
+    // of the shorter one's length
+    BigInt nines1 = big_pow10(40000) - 1, nines2 = big_pow10(3500) - 1;
+    REQUIRE(nines1 * nines2 == big_pow10(43500) - big_pow10(40000) - big_pow10(3500) + 1);
+
+    BigInt num1 = big_random(40000), num2 = big_random(3500), num3 = big_random(3500);
+    REQUIRE(num1 * num2 / num2 == num1);
+    REQUIRE(num1 * (num2 + num3) == num1 * num2 + num1 * num3);
+}
+
+TEST_CASE("Multiplication of odd and even numbers of limbs",
+        "[binary-arithmetic][operators][multiplication]") {
+    // (2^m - 1) * (2^n - 1), with every limb of both operands all ones, so
+    // that every partial product carries, whether the limbs are multiplied
+    // one or two at a time
+    for (int m = 1; m <= 12; m++)
+        for (int n = 1; n <= m; n++) {
+            BigInt ones1 = pow(BigInt(2), 32 * m) - 1, ones2 = pow(BigInt(2), 32 * n) - 1;
+            BigInt product = pow(BigInt(2), 32 * (m + n))
+                             - pow(BigInt(2), 32 * m) - pow(BigInt(2), 32 * n) + 1;
+            REQUIRE(ones1 * ones2 == product);
+            REQUIRE(ones2 * ones1 == product);
+            REQUIRE(ones1 * ones2 / ones2 == ones1);
+            REQUIRE((ones1 - ones2) + ones2 == ones1);
+        }
+
+    for (int m = 1; m <= 24; m++) {
+        BigInt ones = pow(BigInt(2), 32 * m) - 1;
+        REQUIRE(ones * ones == pow(BigInt(2), 64 * m) - pow(BigInt(2), 32 * m + 1) + 1);
+    }
+}
+
 TEST_CASE("Base cases for division", "[binary-arithmetic][operators][division]") {
     BigInt num;
     num = "1234567890123456789012345678901234567890";
@@ -338,6 +446,33 @@ TEST_CASE("Division of big numbers",
     REQUIRE(num1 / num2 == big_pow10(3592));
 }
 
+TEST_CASE("Division of huge numbers",
+        "[binary-arithmetic][operators][division][modulo][big]") {
+    // a quotient limb whose first estimate is too large, so that the divisor
+    // has to be added back to the partial remainder
+    BigInt num1, num2;
+    num1 = "730750819005733825983166798564383948475847409662";
+    num2 = "55340232221128654847";
+    REQUIRE(num1 / num2 == "13204693758526304289683290339");
+    REQUIRE(num1 % num2 == "36893488159826786529");
+
+    // operands long enough for both Algorithm D and recursive division, with
+    // quotients both shorter and longer than the divisors
+    for (size_t num_digits : {50, 500, 5000, 20000}) {
+        BigInt dividend = big_random(num_digits);
+        for (size_t divisor_digits : {(size_t) 1, num_digits / 10, num_digits / 3,
+                                      num_digits - 1}) {
+            BigInt divisor = -big_random(divisor_digits);
+            BigInt quotient = dividend / divisor;
+            BigInt remainder = dividend % divisor;
+
+            REQUIRE(quotient * divisor + remainder == dividend);
+            REQUIRE(remainder >= 0);
+            REQUIRE(remainder < abs(divisor));
+        }
+    }
+}
+
 TEST_CASE("Base cases for modulo", "[binary-arithmetic][operators][modulo]") {
     BigInt num;
     num = "1234567890123456789012345678901234567890";
@@ -389,3 +524,113 @@ TEST_CASE("Modulo of big numbers",
     num2 = big_pow10(19876);
     REQUIRE(num1 % num2 == 0);
 }
+
+TEST_CASE("Quotient and remainder together with divmod()",
+        "[binary-arithmetic][division][modulo][divmod]") {
+    BigInt quotient, remainder;
+
+    // each rounding, for every combination of signs
+    std::tie(quotient, remainder) = divmod(BigInt(7), 2);
+    REQUIRE((quotient == 3 and remainder == 1));
+    std::tie(quotient, remainder) = divmod(-7, BigInt(2));
+    REQUIRE((quotient == -3 and remainder == -1));
+    std::tie(quotient, remainder) = divmod(BigInt(7), -2);
+    REQUIRE((quotient == -3 and remainder == 1));
+    std::tie(quotient, remainder) = divmod(BigInt(-7), BigInt(-2));
+    REQUIRE((quotient == 3 and remainder == -1));
+
+    std::tie(quotient, remainder) = divmod_floor(BigInt(7), 2);
+    REQUIRE((quotient == 3 and remainder == 1));
+    std::tie(quotient, remainder) = divmod_floor(-7, BigInt(2));
+    REQUIRE((quotient == -4 and remainder == 1));
+    std::tie(quotient, remainder) = divmod_floor(BigInt(7), -2);
+    REQUIRE((quotient == -4 and remainder == -1));
+    std::tie(quotient, remainder) = divmod_floor(BigInt(-7), BigInt(-2));
+    REQUIRE((quotient == 3 and remainder == -1));
+
+    std::tie(quotient, remainder) = divmod_ceil(BigInt(7), 2);
+    REQUIRE((quotient == 4 and remainder == -1));
+    std::tie(quotient, remainder) = divmod_ceil(-7, BigInt(2));
+    REQUIRE((quotient == -3 and remainder == -1));
+    std::tie(quotient, remainder) = divmod_ceil(BigInt(7), -2);
+    REQUIRE((quotient == -3 and remainder == 1));
+    std::tie(quotient, remainder) = divmod_ceil(BigInt(-7), BigInt(-2));
+    REQUIRE((quotient == 4 and remainder == 1));
+
+    // exact divisions need no rounding
+    std::tie(quotient, remainder) = divmod_floor(BigInt(-8), 2);
+    REQUIRE((quotient == -4 and remainder == 0));
+    std::tie(quotient, remainder) = divmod_ceil(BigInt(-8), 2);
+    REQUIRE((quotient == -4 and remainder == 0));
+
+    try {
+        std::tie(quotient, remainder) = divmod(BigInt(7), 0);
+    }
+    catch (std::logic_error &e) {
+        CHECK(e.what() == std::string("Attempted division by zero"));
+    }
+
+    for (size_t num_digits : {30, 300, 3000}) {
+        BigInt dividend = -big_random(num_digits);
+        BigInt divisor = big_random(num_digits / 3);
+
+        std::tie(quotient, remainder) = divmod(dividend, divisor);
+        REQUIRE(quotient == dividend / divisor);
+        REQUIRE(remainder == dividend % divisor);
+        std::tie(quotient, remainder) = divmod_floor(dividend, divisor);
+        REQUIRE(quotient * divisor + remainder == dividend);
+        REQUIRE((remainder >= 0 and remainder < divisor));
+        std::tie(quotient, remainder) = divmod_ceil(dividend, divisor);
+        REQUIRE(quotient * divisor + remainder == dividend);
+        REQUIRE((remainder <= 0 and remainder > -divisor));
+    }
+}
+
+TEST_CASE("Binary arithmetic with integers of one and two limbs",
+        "[binary-arithmetic][operators][integer][modulo]") {
+    BigInt num;
+    num = "79228162514264337593543950335";     // 2^96 - 1
+
+    REQUIRE(num + 4294967295 == "79228162514264337597838917630");
+    REQUIRE(num - 4294967295 == "79228162514264337589248983040");
+    REQUIRE(num * 4294967295 == "340282366841710300949110269833929293825");
+    REQUIRE(num / 4294967295 == "18446744078004518913");
+    REQUIRE(num % 4294967295 == 0);
+    REQUIRE(modulo(num, 4294967295) == 0);
+
+    REQUIRE(num + LLONG_MIN == "79228162505040965556689174527");
+    REQUIRE(num - LLONG_MIN == "79228162523487709630398726143");
+    REQUIRE(num * LLONG_MIN == "-730750818665451459101842416348918137791111495680");
+    REQUIRE(num / LLONG_MIN == -8589934591);
+    REQUIRE(num % LLONG_MIN == LLONG_MAX);
+    REQUIRE(modulo(num, LLONG_MIN) == LLONG_MAX);
+
+    num = "-18446744073709551616";              // -2^64
+    REQUIRE(num + 4294967295 == "-18446744069414584321");
+    REQUIRE(num * 3 == "-55340232221128654848");
+    REQUIRE(num / 3 == "-6148914691236517205");
+    REQUIRE(num % 3 == -1);
+    REQUIRE(modulo(num, 3) == -1);
+    REQUIRE(modulo(num, -3) == -1);
+    REQUIRE(num - LLONG_MIN == LLONG_MIN);
+
+    // results that change sign, or become zero
+    num = 5;
+    REQUIRE(num - 7 == -2);
+    REQUIRE(num + -5 == 0);
+    REQUIRE(-num + 5 == 0);
+    REQUIRE(7 - num == 2);
+    REQUIRE(num * 0 == 0);
+    REQUIRE(-num * -1 == 5);
+    REQUIRE(-num / 7 == 0);
+    REQUIRE(modulo(-num, 5) == 0);
+    REQUIRE(-num % 5 == 0);
+
+    try {
+        long long undefined = modulo(num, 0);
+        (void) undefined;
+    }
+    catch (std::logic_error &e) {
+        CHECK(e.what() == std::string("Attempted division by zero"));
+    }
+}
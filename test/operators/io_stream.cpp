@@ -1,8 +1,10 @@
 #include <fstream>
+#include <sstream>
 
 #include "constructors/constructors.hpp"
 #include "operators/io_stream.hpp"
 #include "operators/relational.hpp"
+#include "operators/unary_arithmetic.hpp"
 
 #include "third_party/catch.hpp"
 
@@ -31,4 +33,117 @@ TEST_CASE("File I/O of a BigInt", "[io-stream][operators][file][input][output]")
 
         file.close();
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Stream I/O of a BigInt in hex and octal", "[io-stream][operators][base]") {
+    BigInt num("-3735928559");     // -0xdeadbeef
+
+    std::ostringstream out;
+    out << std::hex << num << " " << std::showbase << num << " "
+        << std::uppercase << num << " " << std::oct << num << " "
+        << std::noshowbase << std::dec << std::showpos << -num << " "
+        << BigInt(0);
+    REQUIRE(out.str() == "-deadbeef -0xdeadbeef -0XDEADBEEF -033653337357 "
+                         "+3735928559 +0");
+
+    // the prefix is left out for zero, as it is for integers
+    out.str("");
+    out << std::noshowpos << std::hex << BigInt(0) << " " << std::oct << BigInt(0);
+    REQUIRE(out.str() == "0 0");
+
+    BigInt num1, num2, num3;
+    std::istringstream in("-DeadBeef 0xdeadbeef 33653337357");
+    in >> std::hex >> num1 >> num2 >> std::oct >> num3;
+    REQUIRE(num1 == num);
+    REQUIRE(num2 == -num);
+    REQUIRE(num3 == -num);
+}
+
+TEST_CASE("Stream input of long BigInts", "[io-stream][operators][input]") {
+    // lengths around the blocks that digits are converted in, and spanning
+    // several of them
+    for (size_t length : {4607, 4608, 4609, 9216, 9217, 7 * 4608 + 5, 40000}) {
+        std::string digits;
+        for (size_t i = 0; i < length; i++)
+            digits += (char) ('0' + (i * 7 + i / 13) % 10);
+        digits[0] = '7';
+
+        BigInt num;
+        std::istringstream in(" -" + digits + " 12");
+        in >> num;
+        REQUIRE(num == BigInt("-" + digits));
+
+        int next;
+        in >> next;
+        REQUIRE(next == 12);
+    }
+
+    // and in the bases that are powers of 2
+    std::string digits;
+    for (size_t i = 0; i < 10000; i++)
+        digits += "0123456789abcdef"[(i * 11 + i / 7) % 16];
+    BigInt num;
+    std::istringstream in("0x" + digits);
+    in >> std::hex >> num;
+    REQUIRE(num == from_string(digits, 16));
+    REQUIRE(in.eof());
+
+    // 3 bits a digit, which straddle limbs
+    std::string octal_digits = digits.substr(0, 9999);
+    for (char& digit : octal_digits)
+        digit = (char) ('0' + digit_value(digit) % 8);
+    in.clear();
+    in.str(octal_digits);
+    in >> std::oct >> num;
+    REQUIRE(num == from_string(octal_digits, 8));
+}
+
+TEST_CASE("Stream input of malformed BigInts", "[io-stream][operators][input]") {
+    BigInt num(42);
+    std::string rest;
+
+    // input stops at the first character that is not a digit
+    std::istringstream in("123abc");
+    in >> num >> rest;
+    REQUIRE(num == 123);
+    REQUIRE(rest == "abc");
+
+    // without any digits, failbit is set instead of throwing
+    in.clear();
+    in.str("abc");
+    REQUIRE_NOTHROW(in >> num);
+    REQUIRE(in.fail());
+    REQUIRE(num == 0);
+
+    num = 42;
+    in.clear();
+    in.str("- 12");
+    in >> num;
+    REQUIRE(in.fail());
+    REQUIRE(num == 0);
+
+    in.clear();
+    in.str("0xg");
+    in >> std::hex >> num;
+    REQUIRE(in.fail());
+    in >> std::dec;
+
+    in.clear();
+    in.str("");
+    in >> num;
+    REQUIRE(in.fail());
+    REQUIRE(in.eof());
+
+    // zero is never negative
+    in.clear();
+    in.str("-000");
+    in >> num;
+    REQUIRE(!in.fail());
+    REQUIRE(num.to_string() == "0");
+
+    // whitespace is only skipped with std::skipws
+    in.clear();
+    in.str(" 12");
+    in >> std::noskipws >> num;
+    REQUIRE(in.fail());
+}
@@ -1,8 +1,10 @@
+#include <climits>
 #include <vector>
 
 #include "constructors/constructors.hpp"
 #include "operators/io_stream.hpp"
 #include "operators/relational.hpp"
+#include "operators/unary_arithmetic.hpp"
 
 #include "third_party/catch.hpp"
 
@@ -82,3 +84,31 @@ TEST_CASE("Relational operators with BigInts and integers or strings",
         REQUIRE(("1234567890" != num) == false);
     }
 }
+
+TEST_CASE("Three-way comparison functions", "[relational][compare]") {
+    std::vector<long long> nums = {     // sorted integers across limb boundaries
+        LLONG_MIN, -4294967297, -4294967296, -4294967295, -1, 0, 1,
+        4294967295, 4294967296, 4294967297, LLONG_MAX
+    };
+
+    for (size_t i = 0; i < nums.size(); i++) {
+        BigInt big_num = nums[i];
+        for (size_t j = 0; j < nums.size(); j++) {
+            int expected = i < j ? -1 : (i > j ? 1 : 0);
+            REQUIRE(compare(big_num, BigInt(nums[j])) == expected);
+            REQUIRE(compare(big_num, nums[j]) == expected);
+
+            unsigned long long abs1 = nums[i] < 0 ? 0ULL - nums[i] : nums[i];
+            unsigned long long abs2 = nums[j] < 0 ? 0ULL - nums[j] : nums[j];
+            expected = abs1 < abs2 ? -1 : (abs1 > abs2 ? 1 : 0);
+            REQUIRE(compare_abs(big_num, BigInt(nums[j])) == expected);
+            REQUIRE(compare_abs(big_num, nums[j]) == expected);
+        }
+    }
+
+    BigInt big_num("-123456789012345678901234567890123456");
+    REQUIRE(compare(big_num, LLONG_MIN) == -1);
+    REQUIRE(compare(-big_num, LLONG_MAX) == 1);
+    REQUIRE(compare_abs(big_num, LLONG_MIN) == 1);
+    REQUIRE(compare_abs(big_num, -big_num) == 0);
+}
@@ -0,0 +1,288 @@
+/*
+    ===========================================================================
+    Tune
+    ===========================================================================
+    Finds the thresholds (see algorithms/thresholds.hpp) at which each
+    algorithm becomes faster than the one before it on this machine, and
+    prints a header that defines them, to be included by defining
+    BIG_INT_TUNING_HEADER as its path.
+    Each algorithm is timed against the one before it on operands of growing
+    lengths, with the shorter products inside them still computed according
+    to the thresholds that this program was compiled with. So running it again
+    with the header that it printed can refine the thresholds a little more.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+
+#include "BigInt.hpp"
+#include "algorithms/division.hpp"
+#include "algorithms/multiplication.hpp"
+#include "algorithms/ntt.hpp"
+#include "algorithms/radix.hpp"
+
+// a threshold is confirmed once the newer algorithm is faster at this many
+// consecutive lengths
+const int CONFIRMATIONS = 3;
+
+// the growth of the lengths that are timed
+const double LENGTH_GROWTH = 1.1;
+
+// the number of timings of an algorithm, of which the best is taken
+const int TIMINGS = 5;
+
+// the shortest time over which an algorithm is repeatedly run for one timing
+const double MIN_TIMING_SECONDS = 0.005;
+
+typedef std::function<void(size_t)> Algorithm;
+
+
+/*
+    random_limbs
+    ------------
+    Returns `size` random limbs, the most significant of which is non-zero.
+*/
+
+LimbVector random_limbs(size_t size) {
+    static std::mt19937 generator(12345);
+    LimbVector limbs(size);
+    for (Limb& limb : limbs)
+        limb = generator();
+    limbs.back() |= 1;
+
+    return limbs;
+}
+
+
+/*
+    time_algorithm
+    --------------
+    Returns the time (in seconds) that a single run of `algorithm` on operands
+    of `size` limbs takes, on average over enough runs to measure it reliably.
+*/
+
+double time_algorithm(const Algorithm& algorithm, size_t size) {
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point start = Clock::now();
+    double elapsed;
+    long runs = 0;
+    do {
+        algorithm(size);
+        runs++;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < MIN_TIMING_SECONDS);
+
+    return elapsed / runs;
+}
+
+
+/*
+    find_threshold
+    --------------
+    Returns the shortest length, from `min_size` up to `max_size`, at which
+    `newer` becomes (and stays) faster than `older`, or `max_size` if it never
+    does.
+*/
+
+size_t find_threshold(const char* name, const Algorithm& older,
+        const Algorithm& newer, size_t min_size, size_t max_size) {
+    std::fprintf(stderr, "%s:", name);
+
+    size_t threshold = max_size;
+    int confirmations = 0;
+    for (size_t size = min_size; size < max_size;
+         size = std::max(size + 1, (size_t) (size * LENGTH_GROWTH))) {
+        // the best of a few timings of each, taken in turns so that both are
+        // equally affected by anything else running on the machine
+        double older_time = 0, newer_time = 0;
+        for (int timing = 0; timing < TIMINGS; timing++) {
+            double time = time_algorithm(older, size);
+            older_time = timing == 0 ? time : std::min(older_time, time);
+            time = time_algorithm(newer, size);
+            newer_time = timing == 0 ? time : std::min(newer_time, time);
+        }
+
+        bool faster = newer_time < older_time;
+        std::fprintf(stderr, " %zu%s", size, faster ? "+" : "-");
+
+        if (!faster)
+            confirmations = 0;
+        else if (confirmations++ == 0)
+            threshold = size;
+        if (confirmations == CONFIRMATIONS)
+            break;
+    }
+    if (confirmations == 0)
+        threshold = max_size;
+
+    std::fprintf(stderr, "\n");
+    return threshold;
+}
+
+
+int main() {
+    // operands for every length that is timed, of which the products and
+    // quotients are the same size, so that they allocate only once
+    LimbVector num1, num2, product, quotient, remainder;
+    auto prepare = [&](size_t size1, size_t size2) {
+        if (num1.size() != size1 or num2.size() != size2) {
+            num1 = random_limbs(size1);
+            num2 = random_limbs(size2);
+            product.resize(size1 + size2);
+        }
+    };
+
+    Algorithm schoolbook_product = [&](size_t size) {
+        prepare(size, size);
+        multiply_schoolbook(product.data(), num1.data(), size, num2.data(), size);
+    };
+    Algorithm karatsuba_product = [&](size_t size) {
+        prepare(size, size);
+        multiply_karatsuba(product, num1.data(), size, num2.data(), size);
+    };
+    Algorithm toom3_product = [&](size_t size) {
+        prepare(size, size);
+        multiply_toom(product, num1.data(), size, num2.data(), size, 3);
+    };
+    Algorithm toom4_product = [&](size_t size) {
+        prepare(size, size);
+        multiply_toom(product, num1.data(), size, num2.data(), size, 4);
+    };
+    Algorithm ntt_product = [&](size_t size) {
+        prepare(size, size);
+        multiply_ntt(product, num1.data(), size, num2.data(), size);
+    };
+
+    Algorithm schoolbook_square = [&](size_t size) {
+        prepare(size, size);
+        square_schoolbook(product.data(), num1.data(), size);
+    };
+    Algorithm karatsuba_square = [&](size_t size) {
+        prepare(size, size);
+        multiply_karatsuba(product, num1.data(), size, num1.data(), size);
+    };
+    Algorithm toom3_square = [&](size_t size) {
+        prepare(size, size);
+        multiply_toom(product, num1.data(), size, num1.data(), size, 3);
+    };
+    Algorithm toom4_square = [&](size_t size) {
+        prepare(size, size);
+        multiply_toom(product, num1.data(), size, num1.data(), size, 4);
+    };
+    Algorithm ntt_square = [&](size_t size) {
+        prepare(size, size);
+        multiply_ntt(product, num1.data(), size, num1.data(), size);
+    };
+
+    // divisions of 2n limbs by n limbs (the length of the divisor), with the
+    // divisor normalised and a quotient of n limbs, as recursive division needs
+    auto prepare_division = [&](size_t size) {
+        if (num2.size() != size or num1.size() != 2 * size) {
+            prepare(2 * size, size);
+            num2.back() |= (Limb) 1 << (LIMB_BITS - 1);
+            num1.back() = num2.back() - 1;
+        }
+    };
+    Algorithm knuth_division = [&](size_t size) {
+        prepare_division(size);
+        divide_knuth(quotient, remainder, num1.data(), 2 * size, num2.data(), size);
+    };
+    Algorithm recursive_division = [&](size_t size) {
+        prepare_division(size);
+        divide_halves(quotient, remainder, num1.data(), 2 * size, num2.data(), size);
+    };
+
+    // decimal strings of 9 digits for every limb
+    std::string digits;
+    auto prepare_digits = [&](size_t size) {
+        if (digits.size() != size * DIGITS_PER_CHUNK) {
+            static std::mt19937 generator(12345);
+            digits.resize(size * DIGITS_PER_CHUNK);
+            for (char& digit : digits)
+                digit = (char) ('0' + generator() % 10);
+        }
+    };
+    Algorithm schoolbook_conversion = [&](size_t size) {
+        prepare_digits(size);
+        digits_to_limbs_schoolbook(product, digits.data(), digits.size(), 10);
+    };
+    Algorithm recursive_conversion = [&](size_t size) {
+        prepare_digits(size);
+        digits_to_limbs_halves(product, digits.data(), digits.size(), 10);
+    };
+
+    // the decimal strings of the same numbers
+    std::string printed;
+    Algorithm schoolbook_printing = [&](size_t size) {
+        prepare(size, size);
+        printed.clear();
+        limbs_to_digits_schoolbook(printed, num1.data(), size, 0, 10);
+    };
+    Algorithm recursive_printing = [&](size_t size) {
+        prepare(size, size);
+        printed.clear();
+        limbs_to_digits_halves(printed, num1.data(), size, 0, 10);
+    };
+
+    size_t karatsuba_threshold = find_threshold("KARATSUBA_THRESHOLD",
+            schoolbook_product, karatsuba_product, 8, 200);
+    size_t toom3_threshold = find_threshold("TOOM3_THRESHOLD",
+            karatsuba_product, toom3_product,
+            std::max(karatsuba_threshold, (size_t) 50), 2000);
+    size_t toom4_threshold = find_threshold("TOOM4_THRESHOLD",
+            toom3_product, toom4_product,
+            std::max(toom3_threshold, (size_t) 100), 8000);
+    size_t ntt_threshold = find_threshold("NTT_THRESHOLD",
+            toom4_product, ntt_product,
+            std::max(toom4_threshold, (size_t) 200), 30000);
+
+    size_t square_karatsuba_threshold = find_threshold("SQUARE_KARATSUBA_THRESHOLD",
+            schoolbook_square, karatsuba_square, 8, 400);
+    size_t square_toom3_threshold = find_threshold("SQUARE_TOOM3_THRESHOLD",
+            karatsuba_square, toom3_square,
+            std::max(square_karatsuba_threshold, (size_t) 50), 2000);
+    size_t square_toom4_threshold = find_threshold("SQUARE_TOOM4_THRESHOLD",
+            toom3_square, toom4_square,
+            std::max(square_toom3_threshold, (size_t) 100), 8000);
+    size_t square_ntt_threshold = find_threshold("SQUARE_NTT_THRESHOLD",
+            toom4_square, ntt_square,
+            std::max(square_toom4_threshold, (size_t) 200), 30000);
+
+    size_t division_recursive_threshold = find_threshold(
+            "DIVISION_RECURSIVE_THRESHOLD", knuth_division, recursive_division,
+            std::max(karatsuba_threshold, (size_t) 8), 2000);
+
+    size_t from_string_threshold = find_threshold("FROM_STRING_THRESHOLD",
+            schoolbook_conversion, recursive_conversion,
+            std::max(karatsuba_threshold, (size_t) 8), 2000);
+    size_t to_string_threshold = find_threshold("TO_STRING_THRESHOLD",
+            schoolbook_printing, recursive_printing, 8, 2000);
+
+    std::printf("/*\n"
+                "    Thresholds for the algorithms of BigInt, tuned for this machine\n"
+                "    by the Tune program.\n"
+                "*/\n\n"
+                "#ifndef BIG_INT_TUNED_THRESHOLDS_HPP\n"
+                "#define BIG_INT_TUNED_THRESHOLDS_HPP\n\n");
+    std::printf("#define BIG_INT_KARATSUBA_THRESHOLD %zu\n", karatsuba_threshold);
+    std::printf("#define BIG_INT_TOOM3_THRESHOLD %zu\n", toom3_threshold);
+    std::printf("#define BIG_INT_TOOM4_THRESHOLD %zu\n", toom4_threshold);
+    std::printf("#define BIG_INT_NTT_THRESHOLD %zu\n\n", ntt_threshold);
+    std::printf("#define BIG_INT_SQUARE_KARATSUBA_THRESHOLD %zu\n",
+                square_karatsuba_threshold);
+    std::printf("#define BIG_INT_SQUARE_TOOM3_THRESHOLD %zu\n", square_toom3_threshold);
+    std::printf("#define BIG_INT_SQUARE_TOOM4_THRESHOLD %zu\n", square_toom4_threshold);
+    std::printf("#define BIG_INT_SQUARE_NTT_THRESHOLD %zu\n\n", square_ntt_threshold);
+    std::printf("#define BIG_INT_DIVISION_RECURSIVE_THRESHOLD %zu\n\n",
+                division_recursive_threshold);
+    std::printf("#define BIG_INT_FROM_STRING_THRESHOLD %zu\n", from_string_threshold);
+    std::printf("#define BIG_INT_TO_STRING_THRESHOLD %zu\n\n", to_string_threshold);
+    std::printf("#endif  // BIG_INT_TUNED_THRESHOLDS_HPP\n");
+
+    return 0;
+}